@@ -97,6 +97,10 @@ enum class StatusCode {
   kInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  kInvalidVectorBias         = -2053, // The bias vector is not a valid OpenCL buffer
+  kInsufficientMemoryBias    = -2052, // The bias vector's OpenCL buffer is too small
+  kInvalidVectorScale        = -2051, // The scaling vector is not a valid OpenCL buffer
+  kInsufficientMemoryScale   = -2050, // The scaling vector's OpenCL buffer is too small
   kInvalidBatchCount         = -2049, // The batch count needs to be positive
   kInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
   kMissingOverrideParameter  = -2047, // Missing override parameter(s) for the target kernel
@@ -121,6 +125,22 @@ enum class Side { kLeft = 141, kRight = 142 };
 enum class Precision { kHalf = 16, kSingle = 32, kDouble = 64,
                        kComplexSingle = 3232, kComplexDouble = 6464, kAny = -1 };
 
+// Levels of validation of the OpenCL buffer arguments (see the SetBufferValidation function)
+enum class BufferValidation { kFull = 0, kCached = 1, kOff = 2 };
+
+// Accuracy modes of the routines (see the SetAccuracy function)
+enum class Accuracy { kFull = 0, kReduced = 1 };
+
+// Modes of the bias and scaling vectors of the GemmEpilogue function: not used, one value per row
+// of matrix C, or one value per column of matrix C
+enum class EpilogueMode { kNone = 0, kPerRow = 1, kPerColumn = 2 };
+
+// Activation functions of the GemmEpilogue function
+enum class Activation { kNone = 0, kRelu = 1, kRelu6 = 2, kClip = 3, kSigmoid = 4 };
+
+// Types of the quantised input matrices of the GemmInt8 function: signed or unsigned 8-bit integers
+enum class QuantizedType { kInt8 = 0, kUint8 = 1 };
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -647,6 +667,113 @@ StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const T
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event = nullptr);
 
+// StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+template <typename T>
+StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// GroupedBatched version of GEMM: SGEMMGROUPEDBATCHED/DGEMMGROUPEDBATCHED/CGEMMGROUPEDBATCHED/ZGEMMGROUPEDBATCHED/HGEMMGROUPEDBATCHED
+template <typename T>
+StatusCode GemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t *ms, const size_t *ns, const size_t *ks,
+                              const T *alphas,
+                              const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                              const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                              const T *betas,
+                              cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of AXPY with arguments in device memory: SAXPYBATCHEDDEVICE/DAXPYBATCHEDDEVICE/CAXPYBATCHEDDEVICE/ZAXPYBATCHEDDEVICE/HAXPYBATCHEDDEVICE
+template <typename T>
+StatusCode AxpyBatched(const size_t n,
+                       const cl_mem alphas,
+                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of GEMM with arguments in device memory: SGEMMBATCHEDDEVICE/DGEMMBATCHEDDEVICE/CGEMMBATCHEDDEVICE/ZGEMMBATCHEDDEVICE/HGEMMBATCHEDDEVICE
+template <typename T>
+StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const cl_mem alphas,
+                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                       const cl_mem betas,
+                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of TRSV: STRSVBATCHED/DTRSVBATCHED/CTRSVBATCHED/ZTRSVBATCHED
+template <typename T>
+StatusCode TrsvBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsvStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t n,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+template <typename T>
+StatusCode TrsmBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
 // =================================================================================================
 
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
@@ -667,6 +794,132 @@ StatusCode PUBLIC_API OverrideParameters(const cl_device_id device, const std::s
 
 // =================================================================================================
 
+// Sets the level of validation of the OpenCL buffer arguments for all further routine calls in this
+// process. With 'kFull' (the default) the size of every buffer is queried on each call, with
+// 'kCached' the sizes are memoised per buffer object, and with 'kOff' the size checks are skipped.
+// The initial level can also be set through the CLBLAST_BUFFER_VALIDATION environmental variable.
+StatusCode PUBLIC_API SetBufferValidation(const BufferValidation validation);
+
+// Sets the accuracy mode for all further routine calls in this process. With 'kFull' (the default)
+// all routines compute their results in the standard way. With 'kReduced' routines may use faster
+// algorithms with a larger rounding error: currently very large real single and double-precision
+// GEMMs use Strassen-Winograd recursion. The initial mode can also be set through the
+// CLBLAST_ACCURACY environmental variable.
+StatusCode PUBLIC_API SetAccuracy(const Accuracy accuracy);
+
+// =================================================================================================
+
+// GEMM with a fused epilogue: computes C = scale * act(alpha * A * B + beta * C + bias), in which
+// 'bias' and 'scale' are optional vectors with one value per row or per column of matrix C, and
+// 'act' is one of the activation functions (clipping to the range [clip_min, clip_max] for kClip).
+// The epilogue is applied in the GEMM kernels before the results are written. Only available for
+// real data-types: SGEMMEPILOGUE/DGEMMEPILOGUE/HGEMMEPILOGUE
+template <typename T>
+StatusCode GemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        const EpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                        const Activation activation, const T clip_min, const T clip_max,
+                        const EpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                        cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Mixed-precision GEMM: computes C = alpha * A * B + beta * C with matrices A and B stored in half
+// precision and with all computations performed in single precision. The template argument sets
+// the precision of matrix C: half or float. This does not require half-precision support of the
+// device. The template argument has to be given explicitly: HGEMMMIXED/SGEMMMIXED
+template <typename T>
+StatusCode GemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const float alpha,
+                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     const float beta,
+                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                     cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Quantised GEMM: computes C = requantise(scale * (A - a_zero_point) * (B - b_zero_point)) with
+// matrices A and B holding signed or unsigned 8-bit integers and with the products accumulated in
+// 32-bit integers. The scale is per-tensor, optionally multiplied by a vector of per-row or
+// per-column scaling factors. The template argument sets the type of matrix C: cl_char (rounded,
+// shifted by c_zero_point and saturated), cl_int (unscaled accumulator), or float (dequantised). The
+// template argument has to be given explicitly: GEMMINT8/GEMMINT8INT32/GEMMINT8FLOAT
+template <typename T>
+StatusCode GemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const QuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                    const int a_zero_point,
+                    const QuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                    const int b_zero_point,
+                    cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                    const int c_zero_point,
+                    const float scale, const EpilogueMode scale_mode,
+                    const cl_mem scale_buffer, const size_t scale_offset,
+                    cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Complex GEMM using the 3M method: computes C = alpha * A * B + beta * C from three real GEMMs on
+// the real and imaginary planes of A and B, saving 25% of the arithmetic at the cost of extra
+// temporary memory and memory traffic. This is worthwhile for large matrices only: CGEMM3M/ZGEMM3M
+template <typename T>
+StatusCode Gemm3m(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                  const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                  cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Blocked Cholesky factorisation of a symmetric (Hermitian) positive-definite matrix: A = L * L^H or
+// A = U^H * U, computed in-place in the given triangle. The first non-positive pivot is stored
+// (1-based) in the unsigned integer 'info_buffer', or zero on success: SPOTRF/DPOTRF/CPOTRF/ZPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Solves A * X = B in-place in B using the Cholesky factorisation computed by Potrf:
+// SPOTRS/DPOTRS/CPOTRS/ZPOTRS
+template <typename T>
+StatusCode Potrs(const Layout layout, const Triangle triangle, const size_t n, const size_t nrhs,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Blocked LU factorisation with partial pivoting of a general m-by-n matrix: A = P * L * U, computed
+// in-place without the unit diagonal of L. The min(m,n) row interchanges are stored as 0-based row
+// indices in the unsigned integer 'ipiv_buffer', and the first exactly-zero pivot (1-based) in
+// 'info_buffer', or zero on success: SGETRF/DGETRF/CGETRF/ZGETRF
+template <typename T>
+StatusCode Getrf(const Layout layout, const size_t m, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem ipiv_buffer, const size_t ipiv_offset,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Solves op(A) * X = B in-place in B using the LU factorisation computed by Getrf:
+// SGETRS/DGETRS/CGETRS/ZGETRS
+template <typename T>
+StatusCode Getrs(const Layout layout, const Transpose a_transpose, const size_t n, const size_t nrhs,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
 } // namespace clblast
 
 // CLBLAST_CLBLAST_H_
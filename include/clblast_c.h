@@ -96,6 +96,10 @@ typedef enum CLBlastStatusCode_ {
   CLBlastInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  CLBlastInvalidVectorBias         = -2053, // The bias vector is not a valid OpenCL buffer
+  CLBlastInsufficientMemoryBias    = -2052, // The bias vector's OpenCL buffer is too small
+  CLBlastInvalidVectorScale        = -2051, // The scaling vector is not a valid OpenCL buffer
+  CLBlastInsufficientMemoryScale   = -2050, // The scaling vector's OpenCL buffer is too small
   CLBlastInvalidBatchCount         = -2049, // The batch count needs to be positive
   CLBlastInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
   CLBlastMissingOverrideParameter  = -2047, // Missing override parameter(s) for the target kernel
@@ -125,6 +129,28 @@ typedef enum CLBlastPrecision_ { CLBlastPrecisionHalf = 16, CLBlastPrecisionSing
                                  CLBlastPrecisionDouble = 64, CLBlastPrecisionComplexSingle = 3232,
                                  CLBlastPrecisionComplexDouble = 6464 } CLBlastPrecision;
 
+// Levels of validation of the OpenCL buffer arguments (see the SetBufferValidation function)
+typedef enum CLBlastBufferValidation_ { CLBlastBufferValidationFull = 0,
+                                        CLBlastBufferValidationCached = 1,
+                                        CLBlastBufferValidationOff = 2 } CLBlastBufferValidation;
+
+// Accuracy modes of the routines (see the SetAccuracy function)
+typedef enum CLBlastAccuracy_ { CLBlastAccuracyFull = 0,
+                                CLBlastAccuracyReduced = 1 } CLBlastAccuracy;
+
+// Modes of the bias and scaling vectors of the GemmEpilogue functions (see the C++ API)
+typedef enum CLBlastEpilogueMode_ { CLBlastEpilogueModeNone = 0, CLBlastEpilogueModePerRow = 1,
+                                    CLBlastEpilogueModePerColumn = 2 } CLBlastEpilogueMode;
+
+// Activation functions of the GemmEpilogue functions (see the C++ API)
+typedef enum CLBlastActivation_ { CLBlastActivationNone = 0, CLBlastActivationRelu = 1,
+                                  CLBlastActivationRelu6 = 2, CLBlastActivationClip = 3,
+                                  CLBlastActivationSigmoid = 4 } CLBlastActivation;
+
+// Types of the quantised input matrices of the GemmInt8 functions (see the C++ API)
+typedef enum CLBlastQuantizedType_ { CLBlastQuantizedTypeInt8 = 0,
+                                     CLBlastQuantizedTypeUint8 = 1 } CLBlastQuantizedType;
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -1429,6 +1455,385 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemmBatched(const CLBlastLayout layout, con
                                                  const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
 
+// StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const float beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const double beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const cl_float2 beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const cl_double2 beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t m, const size_t n, const size_t k,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const cl_half beta,
+                                                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// GroupedBatched version of GEMM: SGEMMGROUPEDBATCHED/DGEMMGROUPEDBATCHED/CGEMMGROUPEDBATCHED/ZGEMMGROUPEDBATCHED/HGEMMGROUPEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t *ms, const size_t *ns, const size_t *ks,
+                                                        const float *alphas,
+                                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                        const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                        const float *betas,
+                                                        cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t *ms, const size_t *ns, const size_t *ks,
+                                                        const double *alphas,
+                                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                        const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                        const double *betas,
+                                                        cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t *ms, const size_t *ns, const size_t *ks,
+                                                        const cl_float2 *alphas,
+                                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                        const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                        const cl_float2 *betas,
+                                                        cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t *ms, const size_t *ns, const size_t *ks,
+                                                        const cl_double2 *alphas,
+                                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                        const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                        const cl_double2 *betas,
+                                                        cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                        const size_t *ms, const size_t *ns, const size_t *ks,
+                                                        const cl_half *alphas,
+                                                        const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                        const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                        const cl_half *betas,
+                                                        cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of AXPY with arguments in device memory: SAXPYBATCHEDDEVICE/DAXPYBATCHEDDEVICE/CAXPYBATCHEDDEVICE/ZAXPYBATCHEDDEVICE/HAXPYBATCHEDDEVICE
+CLBlastStatusCode PUBLIC_API CLBlastSaxpyBatchedDevice(const size_t n,
+                                                       const cl_mem alphas,
+                                                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpyBatchedDevice(const size_t n,
+                                                       const cl_mem alphas,
+                                                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpyBatchedDevice(const size_t n,
+                                                       const cl_mem alphas,
+                                                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpyBatchedDevice(const size_t n,
+                                                       const cl_mem alphas,
+                                                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpyBatchedDevice(const size_t n,
+                                                       const cl_mem alphas,
+                                                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// Batched version of GEMM with arguments in device memory: SGEMMBATCHEDDEVICE/DGEMMBATCHEDDEVICE/CGEMMBATCHEDDEVICE/ZGEMMBATCHEDDEVICE/HGEMMBATCHEDDEVICE
+CLBlastStatusCode PUBLIC_API CLBlastSgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                                       const cl_mem betas,
+                                                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                                       const cl_mem betas,
+                                                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                                       const cl_mem betas,
+                                                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                                       const cl_mem betas,
+                                                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                                       const cl_mem betas,
+                                                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const float *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const double *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_float2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_double2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_half *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_half *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const float beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const double beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_float2 beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_double2 beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_half beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of TRSV: STRSVBATCHED/DTRSVBATCHED/CTRSVBATCHED/ZTRSVBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t n,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t n,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t n,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t n,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t n,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
@@ -1449,6 +1854,227 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
 
 // =================================================================================================
 
+// Sets the level of validation of the OpenCL buffer arguments for all further routine calls in this
+// process. With 'Full' (the default) the size of every buffer is queried on each call, with
+// 'Cached' the sizes are memoised per buffer object, and with 'Off' the size checks are skipped.
+// The initial level can also be set through the CLBLAST_BUFFER_VALIDATION environmental variable.
+CLBlastStatusCode PUBLIC_API CLBlastSetBufferValidation(const CLBlastBufferValidation validation);
+
+// Sets the accuracy mode for all further routine calls in this process. With 'Full' (the default)
+// all routines compute their results in the standard way. With 'Reduced' routines may use faster
+// algorithms with a larger rounding error, see the C++ API for details. The initial mode can also
+// be set through the CLBLAST_ACCURACY environmental variable.
+CLBlastStatusCode PUBLIC_API CLBlastSetAccuracy(const CLBlastAccuracy accuracy);
+
+// =================================================================================================
+
+// GEMM with a fused epilogue: computes C = scale * act(alpha * A * B + beta * C + bias), in which
+// 'bias' and 'scale' are optional vectors with one value per row or per column of matrix C, and
+// 'act' is one of the activation functions. See the C++ API for more details.
+CLBlastStatusCode PUBLIC_API CLBlastSgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const float alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const float beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const CLBlastEpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const CLBlastActivation activation, const float clip_min, const float clip_max,
+                                                  const CLBlastEpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const double alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const double beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const CLBlastEpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const CLBlastActivation activation, const double clip_min, const double clip_max,
+                                                  const CLBlastEpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const cl_half alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const cl_half beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const CLBlastEpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                                  const CLBlastActivation activation, const cl_half clip_min, const cl_half clip_max,
+                                                  const CLBlastEpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Mixed-precision GEMM: matrices A and B are stored in half precision, all computations are done in
+// single precision, and matrix C is stored in half (Hgemm) or single (Sgemm) precision. See the C++
+// API for more details.
+CLBlastStatusCode PUBLIC_API CLBlastHgemmMixed(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const float alpha,
+                                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                               const float beta,
+                                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSgemmMixed(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                               const size_t m, const size_t n, const size_t k,
+                                               const float alpha,
+                                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                               const float beta,
+                                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                               cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Quantised GEMM: matrices A and B hold signed or unsigned 8-bit integers with zero-points, the
+// products are accumulated in 32-bit integers, and matrix C is stored requantised to 8-bit integers
+// (GemmInt8), as 32-bit integers (GemmInt8Int32), or in single precision (GemmInt8Float). See the
+// C++ API for more details.
+CLBlastStatusCode PUBLIC_API CLBlastGemmInt8(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const CLBlastQuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const int a_zero_point,
+                                             const CLBlastQuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const int b_zero_point,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             const int c_zero_point,
+                                             const float scale, const CLBlastEpilogueMode scale_mode,
+                                             const cl_mem scale_buffer, const size_t scale_offset,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastGemmInt8Int32(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const CLBlastQuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const int a_zero_point,
+                                                  const CLBlastQuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const int b_zero_point,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const int c_zero_point,
+                                                  const float scale, const CLBlastEpilogueMode scale_mode,
+                                                  const cl_mem scale_buffer, const size_t scale_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastGemmInt8Float(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const CLBlastQuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const int a_zero_point,
+                                                  const CLBlastQuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const int b_zero_point,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  const int c_zero_point,
+                                                  const float scale, const CLBlastEpilogueMode scale_mode,
+                                                  const cl_mem scale_buffer, const size_t scale_offset,
+                                                  cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Complex GEMM using the 3M method: three real GEMMs on the real and imaginary planes of A and B
+// instead of four real multiplications per complex multiply-accumulate. See the C++ API for more
+// details.
+CLBlastStatusCode PUBLIC_API CLBlastCgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_float2 alpha,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_float2 beta,
+                                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                            cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_double2 alpha,
+                                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                            const cl_double2 beta,
+                                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                            cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Blocked Cholesky factorisation of a symmetric (Hermitian) positive-definite matrix. See the C++
+// API for more details.
+CLBlastStatusCode PUBLIC_API CLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Solver based on the Cholesky factorisation computed by the above routines
+CLBlastStatusCode PUBLIC_API CLBlastSpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Blocked LU factorisation with partial pivoting of a general matrix. See the C++ API for more
+// details.
+CLBlastStatusCode PUBLIC_API CLBlastSgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Solver based on the LU factorisation computed by the above routines
+CLBlastStatusCode PUBLIC_API CLBlastSgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
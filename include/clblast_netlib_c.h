@@ -16,6 +16,8 @@
 #ifndef CLBLAST_CLBLAST_NETLIB_C_H_
 #define CLBLAST_CLBLAST_NETLIB_C_H_
 
+#include <stddef.h> // size_t
+
 // Exports library functions under Windows when building a DLL. See also:
 // https://msdn.microsoft.com/en-us/library/a90k134d.aspx
 #if defined(_WIN32) && defined(CLBLAST_DLL)
@@ -922,6 +924,20 @@ void PUBLIC_API cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspo
 
 // =================================================================================================
 
+// Pins a host array of 'bytes' bytes to the OpenCL device. Any further call with exactly this host
+// pointer re-uses the device copy instead of copying the data again. Results are still copied back
+// to the host. Changes to the host array are detected through a fingerprint of its contents, but
+// can also be signalled explicitly with CLBlastNetlibInvalidate.
+void PUBLIC_API CLBlastNetlibPin(const void* host, const size_t bytes);
+
+// Marks a pinned host array as modified, forcing a new copy to the device upon its next use
+void PUBLIC_API CLBlastNetlibInvalidate(const void* host);
+
+// Releases the device copy of a pinned host array
+void PUBLIC_API CLBlastNetlibUnpin(const void* host);
+
+// =================================================================================================
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -42,10 +42,10 @@ FILES = [
     "/include/clblast_netlib_c.h",
     "/src/clblast_netlib_c.cpp",
 ]
-HEADER_LINES = [122, 78, 126, 24, 29, 41, 29, 65, 32]
-FOOTER_LINES = [25, 139, 27, 38, 6, 6, 6, 9, 2]
+HEADER_LINES = [142, 92, 152, 24, 29, 41, 29, 67, 26]
+FOOTER_LINES = [151, 501, 248, 593, 6, 6, 6, 23, 14]
 HEADER_LINES_DOC = 0
-FOOTER_LINES_DOC = 63
+FOOTER_LINES_DOC = 555
 
 # Different possibilities for requirements
 ald_m = "The value of `a_ld` must be at least `m`."
@@ -61,6 +61,10 @@ bld_transb_k_n = "When `transpose_b == Transpose::kNo`, then `b_ld` must be at l
 bld_trans_n_k = "When `transpose == Transpose::kNo`, then `b_ld` must be at least `n`, otherwise `b_ld` must be at least `k`."
 cld_m = "The value of `c_ld` must be at least `m`."
 cld_n = "The value of `c_ld` must be at least `n`."
+ald_transa_m_k_grouped = "When `transpose_a == Transpose::kNo`, then `a_lds[i]` must be at least `ms[i]`, otherwise `a_lds[i]` must be at least `ks[i]`."
+bld_transb_k_n_grouped = "When `transpose_b == Transpose::kNo`, then `b_lds[i]` must be at least `ks[i]`, otherwise `b_lds[i]` must be at least `ns[i]`."
+cld_m_grouped = "The value of `c_lds[i]` must be at least `ms[i]`."
+batched_device_buffers = "The buffers `alphas` and `betas` must hold at least `batch_count` scalars and the offset buffers at least `batch_count` 32-bit integers."
 
 
 # Helper functions to compute vector and matrix sizes
@@ -166,6 +170,16 @@ ROUTINES = [
   # Batched routines:
   Routine(True,  True,  True,  "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "Batched version of AXPY", "As AXPY, but multiple operations are batched together for better performance.", []),
   Routine(True,  True,  True,  "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM", "As GEMM, but multiple operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
+  Routine(True,  True,  2,     "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "StridedBatched version of GEMM", "As GEMM, but multiple strided operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
+  Routine(True,  True,  3,     "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "GroupedBatched version of GEMM", "As GEMM, but multiple operations of different sizes are batched together for better performance. All work-groups of all batches are launched at once.", [ald_transa_m_k_grouped, bld_transb_k_n_grouped, cld_m_grouped]),
+  Routine(True,  True,  4,     "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "Batched version of AXPY with arguments in device memory", "As AXPYBATCHED, but the scalars and offsets are stored in OpenCL buffers, such that they can be produced on the device without host synchronisation.", []),
+  Routine(True,  True,  4,     "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM with arguments in device memory", "As GEMMBATCHED, but the scalars and offsets are stored in OpenCL buffers, such that they can be produced on the device without host synchronisation.", [ald_transa_m_k, bld_transb_k_n, cld_m, batched_device_buffers]),
+  Routine(True,  True,  True,  "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "Batched version of GEMV", "As GEMV, but multiple operations are batched together for better performance.", [ald_m]),
+  Routine(True,  True,  2,     "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "StridedBatched version of GEMV", "As GEMV, but multiple strided operations are batched together for better performance.", [ald_m]),
+  Routine(True,  True,  True,  "x", "trsv",     T, [S,D,C,Z],     ["n"],                ["layout","triangle","a_transpose","diagonal"],        ["a"],      ["x"],                        [an,xn],         [],               "",    "Batched version of TRSV", "As TRSV, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  2,     "x", "trsv",     T, [S,D,C,Z],     ["n"],                ["layout","triangle","a_transpose","diagonal"],        ["a"],      ["x"],                        [an,xn],         [],               "",    "StridedBatched version of TRSV", "As TRSV, but multiple strided operations are batched together for better performance.", []),
+  Routine(True,  True,  True,  "x", "trsm",     T, [S,D,C,Z],     ["m","n"],            ["layout","side","triangle","a_transpose","diagonal"], ["a"],      ["b"],                        [amns,bmn],      ["alpha"],        "",    "Batched version of TRSM", "As TRSM, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  2,     "x", "trsm",     T, [S,D,C,Z],     ["m","n"],            ["layout","side","triangle","a_transpose","diagonal"], ["a"],      ["b"],                        [amns,bmn],      ["alpha"],        "",    "StridedBatched version of TRSM", "As TRSM, but multiple strided operations are batched together for better performance.", []),
 ]]
 
 
@@ -51,8 +51,8 @@ def clblast_cc(routine):
         result += routine.routine_header_cpp(12, "") + " {" + NL
         result += "  try {" + NL
         result += "    auto queue_cpp = Queue(*queue);" + NL
-        result += "    auto routine = X" + routine.plain_name() + "<" + routine.template.template + ">(queue_cpp, event);" + NL
-        if routine.batched:
+        result += "    auto routine = " + routine.class_name() + "<" + routine.template.template + ">(queue_cpp, event);" + NL
+        if routine.offset_arrays():
             result += "    " + (NL + "    ").join(routine.batched_transform_to_cpp()) + NL
         result += "    routine.Do" + routine.capitalized_name() + "("
         result += ("," + NL + indent1).join([a for a in routine.arguments_clcudaapi()])
@@ -83,10 +83,10 @@ def clblast_c_cc(routine):
     """The C API implementation (.cpp)"""
     result = NL + "// " + routine.name.upper() + NL
     for flavour in routine.flavours:
-        template = "<" + flavour.template + ">" if routine.no_scalars() else ""
+        template = "<" + flavour.template + ">" if routine.no_scalars() or routine.device_arrays() else ""
         indent = " " * (16 + routine.length() + len(template))
         result += routine.routine_header_c(flavour, 27, "") + " {" + NL
-        if routine.batched:
+        if routine.offset_arrays():
             result += "  " + (NL + "  ").join(routine.batched_transform_to_complex(flavour)) + NL
         result += "  try {" + NL
         result += "    return static_cast<CLBlastStatusCode>(" + NL
@@ -120,27 +120,35 @@ def clblast_netlib_c_cc(routine):
             indent = " " * (21 + routine.length() + len(template))
             result += routine.routine_header_netlib(flavour, 9, "") + " {" + NL
 
-            # Initialize OpenCL
-            result += "  auto device = get_device();" + NL
-            result += "  auto context = clblast::Context(device);" + NL
-            result += "  auto queue = clblast::Queue(context, device);" + NL
+            # Retrieves the shared OpenCL run-time
+            result += "  auto &runtime = clblast::NetlibRuntime::Instance();" + NL
+            result += "  const auto &queue = runtime.GetQueue();" + NL
 
             # Set alpha and beta
             result += "".join("  " + s + NL for s in routine.scalar_create_cpp(flavour))
 
+            # Large GEMM and GEMV calls are first tried in a pipelined fashion
+            if routine.name in ["gemm", "gemv"]:
+                pipelined_template = "<" + flavour.buffer_type + ">"
+                pipelined_indent = " " * (24 + routine.length() + len(pipelined_template))
+                result += "  if (runtime.Pipelined" + routine.name.capitalize() + pipelined_template + "("
+                result += ("," + NL + pipelined_indent).join(routine.arguments_pipelined_netlib(flavour))
+                result += ")) {" + NL
+                result += "    return;" + NL
+                result += "  }" + NL
+
             # Copy data structures to the device
             for i, name in enumerate(routine.inputs + routine.outputs):
                 result += "  " + routine.set_size(name, routine.buffer_sizes[i]) + NL
             for i, name in enumerate(routine.inputs + routine.outputs):
                 buffer_type = routine.get_buffer_type(name, flavour)
-                result += "  " + routine.create_buffer(name, buffer_type) + NL
                 if name in routine.scalar_buffers_second_non_pointer():
                     result += "  " + buffer_type + " " + name + "_vec[1]; " + name + "_vec[0] = " + name + ";" + NL
-            for name in routine.inputs + routine.outputs:
-                if name not in routine.scalar_buffers_first():
+                if name in routine.scalar_buffers_first():
+                    result += "  " + routine.create_buffer(name, buffer_type) + NL
+                else:
                     prefix = "" if name in routine.outputs else "const "
-                    buffer_type = routine.get_buffer_type(name, flavour)
-                    result += "  " + routine.write_buffer(name, prefix + buffer_type) + NL
+                    result += "  " + routine.upload_buffer(name, buffer_type, prefix) + NL
 
             # The function call
             result += "  auto queue_cl = queue();" + NL
@@ -33,27 +33,66 @@ class Routine:
         self.details = details
         self.requirements = requirements
 
+    def strided(self):
+        """Batched routines come in four forms: with arrays of offsets (1), with strides (2), grouped with
+        per-batch sizes and leading dimensions (3), or with the scalars and offsets in device memory (4)"""
+        return self.batched == 2
+
+    def grouped(self):
+        return self.batched == 3
+
+    def device_arrays(self):
+        return self.batched == 4
+
+    def offset_arrays(self):
+        """Whether or not the offsets and scalars are passed as host arrays with a value per batch"""
+        return self.batched == 1 or self.grouped()
+
+    def postfix_name(self):
+        if self.strided():
+            return "StridedBatched"
+        if self.grouped():
+            return "GroupedBatched"
+        if self.device_arrays():
+            return "BatchedDevice"
+        return "Batched" if self.batched else ""
+
+    def cpp_postfix_name(self):
+        """The C++ API overloads the regular batched routine for the form with device arrays"""
+        if self.device_arrays():
+            return "Batched"
+        return self.postfix_name()
+
     def lowercase_name(self):
-        postfix = "batched" if self.batched else ""
-        return self.name + postfix
+        return self.name + self.postfix_name().lower()
 
     def plain_name(self):
-        postfix = "Batched" if self.batched else ""
-        return self.name + postfix
+        return self.name + self.postfix_name()
+
+    def class_name(self):
+        return "X" + self.name + self.cpp_postfix_name()
 
     def capitalized_name(self):
-        postfix = "Batched" if self.batched else ""
-        return self.name.capitalize() + postfix
+        return self.name.capitalize() + self.cpp_postfix_name()
 
     def upper_name(self):
-        postfix = "BATCHED" if self.batched else ""
-        return self.name.upper() + postfix
+        return self.name.upper() + self.postfix_name().upper()
 
     def b_star(self):
-        return "*" if self.batched else ""
+        return "*" if self.offset_arrays() else ""
 
     def b_s(self):
-        return "s" if self.batched else ""
+        return "s" if self.offset_arrays() or self.device_arrays() else ""
+
+    def g_star(self):
+        return "*" if self.grouped() else ""
+
+    def g_s(self):
+        return "s" if self.grouped() else ""
+
+    def stride(self, name, prefix=""):
+        """The stride between two consecutive matrices/vectors of a strided-batched routine"""
+        return [prefix + name + "_stride"] if self.strided() else []
 
     def batch_count_def(self):
         return ["const size_t batch_count"] if self.batched else []
@@ -67,17 +106,29 @@ class Routine:
     def batch_count_doc(self):
         return ["`const size_t batch_count`: Number of batches. This value must be positive."] if self.batched else []
 
+    def grouped_arrays(self):
+        """The names of the per-batch sizes and leading dimensions of a grouped-batched routine"""
+        if not self.grouped():
+            return []
+        return ([s + "s" for s in self.sizes] +
+                [b + "_" + self.postfix(b) + "s" for b in self.inputs + self.outputs
+                 if b not in self.buffers_without_ld_inc()])
+
     def batched_transform_to_cpp(self):
         result = []
         for scalar in self.scalars:
             result.append("auto " + scalar + "s_cpp = std::vector<T>();")
         for buffer_name in self.inputs + self.outputs:
             result.append("auto " + buffer_name + "_offsets_cpp = std::vector<size_t>();")
+        for array_name in self.grouped_arrays():
+            result.append("auto " + array_name + "_cpp = std::vector<size_t>();")
         result.append("for (auto batch = size_t{0}; batch < batch_count; ++batch) {")
         for scalar in self.scalars:
             result.append("  " + scalar + "s_cpp.push_back(" + scalar + "s[batch]);")
         for buffer_name in self.inputs + self.outputs:
             result.append("  " + buffer_name + "_offsets_cpp.push_back(" + buffer_name + "_offsets[batch]);")
+        for array_name in self.grouped_arrays():
+            result.append("  " + array_name + "_cpp.push_back(" + array_name + "[batch]);")
         result.append("}")
         return result
 
@@ -147,16 +198,16 @@ class Routine:
 
     @staticmethod
     def create_buffer(name, template):
-        """Creates a new CLCudaAPI buffer"""
-        return "auto " + name + "_buffer = clblast::Buffer<" + template + ">(context, " + name + "_size);"
+        """Retrieves a staging buffer from the pool of the Netlib run-time"""
+        return "auto " + name + "_buffer = runtime.Acquire<" + template + ">(" + name + "_size);"
 
-    def write_buffer(self, name, template):
-        """Writes to a CLCudaAPI buffer"""
+    def upload_buffer(self, name, template, prefix):
+        """Retrieves a buffer from the Netlib run-time with a device copy of the host data"""
         postfix = ""
         if name in self.scalar_buffers_second_non_pointer():
             postfix = "_vec"
-        data_structure = "reinterpret_cast<" + template + "*>(" + name + postfix + ")"
-        return name + "_buffer.Write(queue, " + name + "_size, " + data_structure + ");"
+        data_structure = "reinterpret_cast<" + prefix + template + "*>(" + name + postfix + ")"
+        return "auto " + name + "_buffer = runtime.Upload<" + template + ">(" + data_structure + ", " + name + "_size);"
 
     @staticmethod
     def read_buffer(name, template):
@@ -164,6 +215,23 @@ class Routine:
         data_structure = "reinterpret_cast<" + template + "*>(" + name + ")"
         return name + "_buffer.Read(queue, " + name + "_size, " + data_structure + ");"
 
+    def arguments_pipelined_netlib(self, flavour):
+        """Arguments for the pipelined versions of GEMM and GEMV in the Netlib run-time"""
+        data_type = flavour.buffer_type
+        arguments = ["static_cast<clblast::Layout>(layout)", "static_cast<clblast::Transpose>(a_transpose)"]
+        if self.name == "gemm":
+            arguments += ["static_cast<clblast::Transpose>(b_transpose)", "m, n, k"]
+            buffers = [("a", "const ", "a_ld"), ("b", "const ", "b_ld"), ("c", "", "c_ld")]
+        else:
+            arguments += ["m, n"]
+            buffers = [("a", "const ", "a_ld"), ("x", "const ", "x_inc"), ("y", "", "y_inc")]
+        arguments += ["alpha_cpp"]
+        for name, prefix, postfix in buffers:
+            if name == buffers[2][0]:
+                arguments += ["beta_cpp"]
+            arguments += ["reinterpret_cast<" + prefix + data_type + "*>(" + name + "), " + postfix]
+        return arguments
+
     def non_index_inputs(self):
         """Lists of input/output buffers not index (integer)"""
         buffers = self.inputs[:]  # make a copy
@@ -193,6 +261,10 @@ class Routine:
         """Retrieves the number of characters in the routine's name"""
         return len(self.capitalized_name())
 
+    def length_c(self):
+        """As above, but for the name in the C API"""
+        return len(self.plain_name())
+
     def no_scalars(self):
         """Determines whether or not this routine has scalar arguments (alpha/beta)"""
         return self.scalars == []
@@ -228,8 +300,8 @@ class Routine:
         if name in self.inputs or name in self.outputs:
             a = [name + "_buffer"]
             b = [name + "_offset" + self.b_s()]
-            c = [name + "_" + self.postfix(name)] if (name not in self.buffers_without_ld_inc()) else []
-            return [", ".join(a + b + c)]
+            c = [name + "_" + self.postfix(name) + self.g_s()] if (name not in self.buffers_without_ld_inc()) else []
+            return [", ".join(a + b + c + self.stride(name))]
         return []
 
     def buffer_bis(self, name):
@@ -256,8 +328,11 @@ class Routine:
         if name in self.inputs or name in self.outputs:
             a = [prefix + "cl_mem " + name + "_buffer"]
             b = ["const size_t " + self.b_star() + name + "_offset" + self.b_s()]
-            c = ["const size_t " + name + "_" + self.postfix(name)] if name not in self.buffers_without_ld_inc() else []
-            return [", ".join(a + b + c)]
+            if self.device_arrays():
+                b = ["const cl_mem " + name + "_offsets"]
+            c = ["const size_t " + self.g_star() + name + "_" + self.postfix(name) + self.g_s()]\
+                if name not in self.buffers_without_ld_inc() else []
+            return [", ".join(a + b + c + self.stride(name, "const size_t "))]
         return []
 
     def buffer_def_wrapper_cl(self, name, flavour):
@@ -306,9 +381,12 @@ class Routine:
         if name in self.inputs or name in self.outputs:
             buffer_type = "unsigned int" if (name in self.index_buffers()) else self.template.buffer_type
             a = ["Buffer<" + buffer_type + ">(" + name + "_buffer)"]
-            b = [name + "_offsets_cpp"] if self.batched else [name + "_offset"]
-            c = [name + "_" + self.postfix(name)] if (name not in self.buffers_without_ld_inc()) else []
-            return [", ".join(a + b + c)]
+            b = [name + "_offsets_cpp"] if self.offset_arrays() else [name + "_offset"]
+            if self.device_arrays():
+                b = ["Buffer<int>(" + name + "_offsets)"]
+            c = [name + "_" + self.postfix(name) + self.g_s() + ("_cpp" if self.grouped() else "")]\
+                if (name not in self.buffers_without_ld_inc()) else []
+            return [", ".join(a + b + c + self.stride(name))]
         return []
 
     def buffer_wrapper_clblas(self, name):
@@ -374,9 +452,10 @@ class Routine:
         prefix = "const " if (name in self.inputs) else ""
         if (name in self.inputs) or (name in self.outputs):
             a = [prefix + "cl_mem"]
-            b = ["const size_t" + self.b_star()]
-            c = ["const size_t"] if (name not in self.buffers_without_ld_inc()) else []
-            return [", ".join(a + b + c)]
+            b = ["const cl_mem"] if self.device_arrays() else ["const size_t" + self.b_star()]
+            c = ["const size_t" + self.g_star()] if (name not in self.buffers_without_ld_inc()) else []
+            d = ["const size_t"] if self.strided() else []
+            return [", ".join(a + b + c + d)]
         return []
 
     def buffer_doc(self, name):
@@ -388,18 +467,28 @@ class Routine:
             inc_ld_description = "Leading dimension " if (name in self.buffers_matrix()) else "Stride/increment "
             a = ["`" + prefix + "cl_mem " + name + "_buffer`: OpenCL buffer to store the " + inout + " " + math_name + "."]
             b = ["`const size_t " + self.b_star() + name + "_offset" + self.b_s() + "`: The offset" + self.b_s() + " in elements from the start of the " + inout + " " + math_name + "."]
+            if self.device_arrays():
+                b = ["`const cl_mem " + name + "_offsets`: OpenCL buffer with the offsets (32-bit integers) in elements from the start of the " + inout + " " + math_name + ", one per batch."]
             c = []
-            if name not in self.buffers_without_ld_inc():
+            if name not in self.buffers_without_ld_inc() and self.grouped():
+                c = ["`const size_t " + self.g_star() + name + "_" + self.postfix(name) + self.g_s() + "`: " +
+                     inc_ld_description + "per batch of the " + inout + " " + math_name + ". These values must be greater than 0."]
+            elif name not in self.buffers_without_ld_inc():
                 c = ["`const size_t " + name + "_" + self.postfix(name) + "`: " +
                      inc_ld_description + "of the " + inout + " " + math_name + ". This value must be greater than 0."]
-            return a + b + c
+            d = []
+            if self.strided():
+                d = ["`const size_t " + name + "_stride`: The (fixed) stride between two batches of the " + inout + " " + math_name + "."]
+            return a + b + c + d
         return []
 
     def scalar(self, name):
         """Retrieves the name of a scalar (alpha/beta)"""
         if name in self.scalars:
-            if self.batched:
+            if self.offset_arrays():
                 return [name + "s_cpp"]
+            if self.device_arrays():
+                return ["Buffer<T>(" + name + "s)"]
             return [name]
         return []
 
@@ -418,12 +507,14 @@ class Routine:
     def scalar_use(self, name, flavour):
         """Retrieves the use of a scalar (alpha/beta)"""
         if name in self.scalars:
+            if self.device_arrays():
+                return [name + "s"]
             if name == "alpha":
-                if self.batched:
+                if self.offset_arrays():
                     return ["alphas_cpp.data()"]
                 return [flavour.use_alpha()]
             elif name == "beta":
-                if self.batched:
+                if self.offset_arrays():
                     return ["betas_cpp.data()"]
                 return [flavour.use_beta()]
             return [name]
@@ -458,6 +549,8 @@ class Routine:
     def scalar_def(self, name, flavour):
         """Retrieves the definition of a scalar (alpha/beta)"""
         if name in self.scalars:
+            if self.device_arrays():
+                return ["const cl_mem " + name + "s"]
             if name == "alpha":
                 return ["const " + flavour.alpha_cl + " " + self.b_star() + name + self.b_s()]
             return ["const " + flavour.beta_cl + " " + self.b_star() + name + self.b_s()]
@@ -466,6 +559,8 @@ class Routine:
     def scalar_def_plain(self, name, flavour):
         """As above, but without 'cl_' prefix"""
         if name in self.scalars:
+            if self.device_arrays():
+                return ["const cl_mem " + name + "s"]
             if name == "alpha":
                 return ["const " + flavour.alpha_cpp + " " + self.b_star() + name + self.b_s()]
             return ["const " + flavour.beta_cpp + " " + self.b_star() + name + self.b_s()]
@@ -484,6 +579,8 @@ class Routine:
     def scalar_type(self, name, flavour):
         """Retrieves the type of a scalar (alpha/beta)"""
         if name in self.scalars:
+            if self.device_arrays():
+                return ["const cl_mem"]
             if name == "alpha":
                 return ["const " + flavour.alpha_cpp + self.b_star()]
             return ["const " + flavour.beta_cpp + self.b_star()]
@@ -492,6 +589,8 @@ class Routine:
     def scalar_doc(self, name):
         """Retrieves the documentation of a scalar"""
         if name in self.scalars:
+            if self.device_arrays():
+                return ["`const cl_mem " + name + "s`: OpenCL buffer with the input scalar constants, one per batch."]
             if name == "alpha":
                 return ["`const " + self.template.alpha_cpp + " " + self.b_star() + name + self.b_s() + "`: Input scalar constant" + self.b_s() + "."]
             return ["`const " + self.template.beta_cpp + " " + self.b_star() + name + self.b_s() + "`: Input scalar constant" + self.b_s() + "."]
@@ -510,9 +609,15 @@ class Routine:
     def sizes_list(self):
         """Retrieves a list of comma-separated sizes (m, n, k)"""
         if self.sizes:
-            return [", ".join([s for s in self.sizes])]
+            return [", ".join([s + self.g_s() for s in self.sizes])]
         return []
 
+    def sizes_list_clcudaapi(self):
+        """As above, but with the per-batch sizes of a grouped-batched routine as vectors"""
+        if self.sizes and self.grouped():
+            return [", ".join([s + "s_cpp" for s in self.sizes])]
+        return self.sizes_list()
+
     def sizes_list_as_int(self):
         """Retrieves a list of comma-separated sizes (m, n, k) cast to integers"""
         if self.sizes:
@@ -522,7 +627,7 @@ class Routine:
     def sizes_def(self):
         """Retrieves the definition of the sizes (m,n,k)"""
         if self.sizes:
-            return [", ".join(["const size_t " + s for s in self.sizes])]
+            return [", ".join(["const size_t " + self.g_star() + s + self.g_s() for s in self.sizes])]
         return []
 
     def sizes_def_netlib(self):
@@ -534,11 +639,15 @@ class Routine:
     def sizes_type(self):
         """Retrieves the types of the sizes (m,n,k)"""
         if self.sizes:
-            return [", ".join(["const size_t" for s in self.sizes])]
+            return [", ".join(["const size_t" + self.g_star() for s in self.sizes])]
         return []
 
     def sizes_doc(self):
         """# Retrieves the documentation of the sizes"""
+        if self.sizes and self.grouped():
+            definitions = ["`const size_t *" + s + "s`: Integer size arguments, one per batch. These values must be positive."
+                           for s in self.sizes]
+            return definitions
         if self.sizes:
             definitions = ["`const size_t " + s + "`: Integer size argument. This value must be positive." for s in self.sizes]
             return definitions
@@ -639,7 +748,7 @@ class Routine:
 
     def arguments_clcudaapi(self):
         """Retrieves a combination of all the argument names, with CLCudaAPI casts"""
-        return (self.options_list() + self.sizes_list() +
+        return (self.options_list() + self.sizes_list_clcudaapi() +
                 list(chain(*[self.buffer_clcudaapi(b) for b in self.scalar_buffers_first()])) +
                 self.scalar("alpha") +
                 list(chain(*[self.buffer_clcudaapi(b) for b in self.buffers_first()])) +
@@ -824,7 +933,7 @@ class Routine:
 
     def routine_header_c(self, flavour, spaces, extra_qualifier):
         """As above, but now for C"""
-        indent = " " * (spaces + self.length())
+        indent = " " * (spaces + self.length_c())
         result = "CLBlastStatusCode" + extra_qualifier + " CLBlast" + flavour.name + self.plain_name() + "("
         result += (",\n" + indent).join([a for a in self.arguments_def_c(flavour)])
         result += ",\n" + indent + "cl_command_queue* queue, cl_event* event)"
@@ -845,8 +954,7 @@ class Routine:
         if self.name in self.routines_scalar_no_return():
             routine_name += "_sub"
             indent += "    "
-        if self.batched:
-            routine_name += "batched"
+        routine_name += self.postfix_name().lower()
         result = return_type + extra_qualifier + " cblas_" + flavour.name.lower() + routine_name + "("
         result += (",\n" + indent).join([a for a in self.arguments_def_netlib(flavour)]) + ")"
         return result
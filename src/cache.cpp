@@ -126,5 +126,10 @@ template void ProgramCache::RemoveBySubset<1, 2>(const ProgramKey &); // precisi
 template class Cache<DatabaseKey, Database>;
 template Database DatabaseCache::Get(const DatabaseKeyRef &, bool *) const;
 
+// =================================================================================================
+
+template class Cache<BufferSizeKey, size_t>;
+template size_t BufferSizeCache::Get(const BufferSizeKey &, bool *) const;
+
 // =================================================================================================
 } // namespace clblast
@@ -102,6 +102,17 @@ typedef Cache<DatabaseKey, Database> DatabaseCache;
 extern template class Cache<DatabaseKey, Database>;
 extern template Database DatabaseCache::Get(const DatabaseKeyRef &, bool *) const;
 
+// =================================================================================================
+
+// The key for the cache of OpenCL buffer sizes in bytes (used for the 'cached' buffer validation).
+// Entries are removed through a destructor callback once the buffer is released.
+typedef cl_mem BufferSizeKey;
+
+typedef Cache<BufferSizeKey, size_t> BufferSizeCache;
+
+extern template class Cache<BufferSizeKey, size_t>;
+extern template size_t BufferSizeCache::Get(const BufferSizeKey &, bool *) const;
+
 // =================================================================================================
 } // namespace clblast
 
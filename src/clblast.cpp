@@ -74,6 +74,20 @@
 #include "routines/levelx/xomatcopy.hpp"
 #include "routines/levelx/xaxpybatched.hpp"
 #include "routines/levelx/xgemmbatched.hpp"
+#include "routines/levelx/xgemmstridedbatched.hpp"
+#include "routines/levelx/xgemmgroupedbatched.hpp"
+#include "routines/levelx/xgemvbatched.hpp"
+#include "routines/levelx/xgemvstridedbatched.hpp"
+#include "routines/levelx/xtrsvbatched.hpp"
+#include "routines/levelx/xtrsvstridedbatched.hpp"
+#include "routines/levelx/xtrsmbatched.hpp"
+#include "routines/levelx/xtrsmstridedbatched.hpp"
+#include "routines/levelx/xgemmepilogue.hpp"
+#include "routines/levelx/xgemmmixed.hpp"
+#include "routines/levelx/xgemmint8.hpp"
+#include "routines/levelx/xgemm3m.hpp"
+#include "routines/levelx/xpotrf.hpp"
+#include "routines/levelx/xgetrf.hpp"
 
 
 // Dvdt Infer
@@ -2451,13 +2465,656 @@ template StatusCode PUBLIC_API GemmBatched<half>(const Layout, const Transpose,
                                                  cl_mem, const size_t*, const size_t,
                                                  const size_t,
                                                  cl_command_queue*, cl_event*);
-// =================================================================================================
+
+// StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+template <typename T>
+StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmStridedBatched<T>(queue_cpp, event);
+    routine.DoGemmStridedBatched(layout, a_transpose, b_transpose,
+                                 m, n, k,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 beta,
+                                 Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmStridedBatched<float>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<double>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<float2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<double2>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<half>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// GroupedBatched version of GEMM: SGEMMGROUPEDBATCHED/DGEMMGROUPEDBATCHED/CGEMMGROUPEDBATCHED/ZGEMMGROUPEDBATCHED/HGEMMGROUPEDBATCHED
+template <typename T>
+StatusCode GemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t *ms, const size_t *ns, const size_t *ks,
+                              const T *alphas,
+                              const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                              const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                              const T *betas,
+                              cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmGroupedBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    auto c_offsets_cpp = std::vector<size_t>();
+    auto ms_cpp = std::vector<size_t>();
+    auto ns_cpp = std::vector<size_t>();
+    auto ks_cpp = std::vector<size_t>();
+    auto a_lds_cpp = std::vector<size_t>();
+    auto b_lds_cpp = std::vector<size_t>();
+    auto c_lds_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+      c_offsets_cpp.push_back(c_offsets[batch]);
+      ms_cpp.push_back(ms[batch]);
+      ns_cpp.push_back(ns[batch]);
+      ks_cpp.push_back(ks[batch]);
+      a_lds_cpp.push_back(a_lds[batch]);
+      b_lds_cpp.push_back(b_lds[batch]);
+      c_lds_cpp.push_back(c_lds[batch]);
+    }
+    routine.DoGemmGroupedBatched(layout, a_transpose, b_transpose,
+                                 ms_cpp, ns_cpp, ks_cpp,
+                                 alphas_cpp,
+                                 Buffer<T>(a_buffer), a_offsets_cpp, a_lds_cpp,
+                                 Buffer<T>(b_buffer), b_offsets_cpp, b_lds_cpp,
+                                 betas_cpp,
+                                 Buffer<T>(c_buffer), c_offsets_cpp, c_lds_cpp,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmGroupedBatched<float>(const Layout, const Transpose, const Transpose,
+                                                         const size_t*, const size_t*, const size_t*,
+                                                         const float*,
+                                                         const cl_mem, const size_t*, const size_t*,
+                                                         const cl_mem, const size_t*, const size_t*,
+                                                         const float*,
+                                                         cl_mem, const size_t*, const size_t*,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<double>(const Layout, const Transpose, const Transpose,
+                                                          const size_t*, const size_t*, const size_t*,
+                                                          const double*,
+                                                          const cl_mem, const size_t*, const size_t*,
+                                                          const cl_mem, const size_t*, const size_t*,
+                                                          const double*,
+                                                          cl_mem, const size_t*, const size_t*,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<float2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t*, const size_t*, const size_t*,
+                                                          const float2*,
+                                                          const cl_mem, const size_t*, const size_t*,
+                                                          const cl_mem, const size_t*, const size_t*,
+                                                          const float2*,
+                                                          cl_mem, const size_t*, const size_t*,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<double2>(const Layout, const Transpose, const Transpose,
+                                                           const size_t*, const size_t*, const size_t*,
+                                                           const double2*,
+                                                           const cl_mem, const size_t*, const size_t*,
+                                                           const cl_mem, const size_t*, const size_t*,
+                                                           const double2*,
+                                                           cl_mem, const size_t*, const size_t*,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<half>(const Layout, const Transpose, const Transpose,
+                                                        const size_t*, const size_t*, const size_t*,
+                                                        const half*,
+                                                        const cl_mem, const size_t*, const size_t*,
+                                                        const cl_mem, const size_t*, const size_t*,
+                                                        const half*,
+                                                        cl_mem, const size_t*, const size_t*,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of AXPY with arguments in device memory: SAXPYBATCHEDDEVICE/DAXPYBATCHEDDEVICE/CAXPYBATCHEDDEVICE/ZAXPYBATCHEDDEVICE/HAXPYBATCHEDDEVICE
+template <typename T>
+StatusCode AxpyBatched(const size_t n,
+                       const cl_mem alphas,
+                       const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                       cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XaxpyBatched<T>(queue_cpp, event);
+    routine.DoAxpyBatched(n,
+                          Buffer<T>(alphas),
+                          Buffer<T>(x_buffer), Buffer<int>(x_offsets), x_inc,
+                          Buffer<T>(y_buffer), Buffer<int>(y_offsets), y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyBatched<float>(const size_t,
+                                                  const cl_mem,
+                                                  const cl_mem, const cl_mem, const size_t,
+                                                  cl_mem, const cl_mem, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyBatched<double>(const size_t,
+                                                   const cl_mem,
+                                                   const cl_mem, const cl_mem, const size_t,
+                                                   cl_mem, const cl_mem, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyBatched<float2>(const size_t,
+                                                   const cl_mem,
+                                                   const cl_mem, const cl_mem, const size_t,
+                                                   cl_mem, const cl_mem, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyBatched<double2>(const size_t,
+                                                    const cl_mem,
+                                                    const cl_mem, const cl_mem, const size_t,
+                                                    cl_mem, const cl_mem, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
+                                                 const cl_mem,
+                                                 const cl_mem, const cl_mem, const size_t,
+                                                 cl_mem, const cl_mem, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Batched version of GEMM with arguments in device memory: SGEMMBATCHEDDEVICE/DGEMMBATCHEDDEVICE/CGEMMBATCHEDDEVICE/ZGEMMBATCHEDDEVICE/HGEMMBATCHEDDEVICE
+template <typename T>
+StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const cl_mem alphas,
+                       const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                       const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                       const cl_mem betas,
+                       cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmBatched<T>(queue_cpp, event);
+    routine.DoGemmBatched(layout, a_transpose, b_transpose,
+                          m, n, k,
+                          Buffer<T>(alphas),
+                          Buffer<T>(a_buffer), Buffer<int>(a_offsets), a_ld,
+                          Buffer<T>(b_buffer), Buffer<int>(b_offsets), b_ld,
+                          Buffer<T>(betas),
+                          Buffer<T>(c_buffer), Buffer<int>(c_offsets), c_ld,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmBatched<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem,
+                                                  const cl_mem, const cl_mem, const size_t,
+                                                  const cl_mem, const cl_mem, const size_t,
+                                                  const cl_mem,
+                                                  cl_mem, const cl_mem, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatched<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const cl_mem,
+                                                   const cl_mem, const cl_mem, const size_t,
+                                                   const cl_mem, const cl_mem, const size_t,
+                                                   const cl_mem,
+                                                   cl_mem, const cl_mem, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatched<float2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const cl_mem,
+                                                   const cl_mem, const cl_mem, const size_t,
+                                                   const cl_mem, const cl_mem, const size_t,
+                                                   const cl_mem,
+                                                   cl_mem, const cl_mem, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatched<double2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const cl_mem,
+                                                    const cl_mem, const cl_mem, const size_t,
+                                                    const cl_mem, const cl_mem, const size_t,
+                                                    const cl_mem,
+                                                    cl_mem, const cl_mem, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatched<half>(const Layout, const Transpose, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const cl_mem,
+                                                 const cl_mem, const cl_mem, const size_t,
+                                                 const cl_mem, const cl_mem, const size_t,
+                                                 const cl_mem,
+                                                 cl_mem, const cl_mem, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          betas_cpp,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const double*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const float2*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const double2*,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const half*,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvStridedBatched<T>(queue_cpp, event);
+    routine.DoGemvStridedBatched(layout, a_transpose,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 beta,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvStridedBatched<float>(const Layout, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<float2>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double2>(const Layout, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<half>(const Layout, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of TRSV: STRSVBATCHED/DTRSVBATCHED/CTRSVBATCHED/ZTRSVBATCHED
+template <typename T>
+StatusCode TrsvBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t n,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsvBatched<T>(queue_cpp, event);
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+    }
+    routine.DoTrsvBatched(layout, triangle, a_transpose, diagonal,
+                          n,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsvBatched<float>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                  const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvBatched<double>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvBatched<float2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvBatched<double2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                    const size_t,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+
+// StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsvStridedBatched(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t n,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsvStridedBatched<T>(queue_cpp, event);
+    routine.DoTrsvStridedBatched(layout, triangle, a_transpose, diagonal,
+                                 n,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsvStridedBatched<float>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvStridedBatched<double>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvStridedBatched<float2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsvStridedBatched<double2>(const Layout, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+
+// Batched version of TRSM: STRSMBATCHED/DTRSMBATCHED/CTRSMBATCHED/ZTRSMBATCHED
+template <typename T>
+StatusCode TrsmBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsmBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+    }
+    routine.DoTrsmBatched(layout, side, triangle, a_transpose, diagonal,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+
+// StridedBatched version of TRSM: STRSMSTRIDEDBATCHED/DTRSMSTRIDEDBATCHED/CTRSMSTRIDEDBATCHED/ZTRSMSTRIDEDBATCHED
+template <typename T>
+StatusCode TrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XtrsmStridedBatched<T>(queue_cpp, event);
+    routine.DoTrsmStridedBatched(layout, side, triangle, a_transpose, diagonal,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrsmStridedBatched<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmStridedBatched<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmStridedBatched<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrsmStridedBatched<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);// =================================================================================================
 
 // Clears the cache of stored binaries
 StatusCode ClearCache() {
   try {
     ProgramCache::Instance().Invalidate();
     BinaryCache::Instance().Invalidate();
+    BufferSizeCache::Instance().Invalidate();
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
@@ -2588,5 +3245,366 @@ StatusCode OverrideParameters(const cl_device_id device, const std::string &kern
   return StatusCode::kSuccess;
 }
 
+// =================================================================================================
+
+// Sets the level of validation of the OpenCL buffer arguments
+StatusCode SetBufferValidation(const BufferValidation validation) {
+  try {
+    SetBufferValidationLevel(validation);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Sets the accuracy mode of the routines
+StatusCode SetAccuracy(const Accuracy accuracy) {
+  try {
+    if (accuracy != Accuracy::kFull && accuracy != Accuracy::kReduced) {
+      throw BLASError(StatusCode::kInvalidValue);
+    }
+    SetAccuracyMode(accuracy);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// GEMM with a fused epilogue: SGEMMEPILOGUE/DGEMMEPILOGUE/HGEMMEPILOGUE
+template <typename T>
+StatusCode GemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        const EpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                        const Activation activation, const T clip_min, const T clip_max,
+                        const EpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                        cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmEpilogue<T>(queue_cpp, event);
+    routine.DoGemmEpilogue(layout, a_transpose, b_transpose,
+                           m, n, k,
+                           alpha,
+                           Buffer<T>(a_buffer), a_offset, a_ld,
+                           Buffer<T>(b_buffer), b_offset, b_ld,
+                           beta,
+                           Buffer<T>(c_buffer), c_offset, c_ld,
+                           bias_mode, Buffer<T>(bias_buffer), bias_offset,
+                           activation, clip_min, clip_max,
+                           scale_mode, Buffer<T>(scale_buffer), scale_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmEpilogue<float>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const float,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const float,
+                                                   cl_mem, const size_t, const size_t,
+                                                   const EpilogueMode, const cl_mem, const size_t,
+                                                   const Activation, const float, const float,
+                                                   const EpilogueMode, const cl_mem, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmEpilogue<double>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const double,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const double,
+                                                    cl_mem, const size_t, const size_t,
+                                                    const EpilogueMode, const cl_mem, const size_t,
+                                                    const Activation, const double, const double,
+                                                    const EpilogueMode, const cl_mem, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmEpilogue<half>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const half,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const half,
+                                                  cl_mem, const size_t, const size_t,
+                                                  const EpilogueMode, const cl_mem, const size_t,
+                                                  const Activation, const half, const half,
+                                                  const EpilogueMode, const cl_mem, const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Mixed-precision GEMM: HGEMMMIXED/SGEMMMIXED
+template <typename T>
+StatusCode GemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const float alpha,
+                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     const float beta,
+                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                     cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmMixed<T>(queue_cpp, event);
+    routine.DoGemmMixed(layout, a_transpose, b_transpose,
+                        m, n, k,
+                        alpha,
+                        Buffer<half>(a_buffer), a_offset, a_ld,
+                        Buffer<half>(b_buffer), b_offset, b_ld,
+                        beta,
+                        Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmMixed<half>(const Layout, const Transpose, const Transpose,
+                                               const size_t, const size_t, const size_t,
+                                               const float,
+                                               const cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               const float,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmMixed<float>(const Layout, const Transpose, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const float,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const float,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Quantised GEMM: GEMMINT8/GEMMINT8INT32/GEMMINT8FLOAT
+template <typename T>
+StatusCode GemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const QuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                    const int a_zero_point,
+                    const QuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                    const int b_zero_point,
+                    cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                    const int c_zero_point,
+                    const float scale, const EpilogueMode scale_mode,
+                    const cl_mem scale_buffer, const size_t scale_offset,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmInt8<T>(queue_cpp, event);
+    routine.DoGemmInt8(layout, a_transpose, b_transpose,
+                       m, n, k,
+                       a_type, Buffer<cl_uchar>(a_buffer), a_offset, a_ld, a_zero_point,
+                       b_type, Buffer<cl_uchar>(b_buffer), b_offset, b_ld, b_zero_point,
+                       Buffer<T>(c_buffer), c_offset, c_ld, c_zero_point,
+                       scale, scale_mode, Buffer<float>(scale_buffer), scale_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmInt8<cl_char>(const Layout, const Transpose, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const QuantizedType, const cl_mem, const size_t, const size_t, const int,
+                                                 const QuantizedType, const cl_mem, const size_t, const size_t, const int,
+                                                 cl_mem, const size_t, const size_t, const int,
+                                                 const float, const EpilogueMode, const cl_mem, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmInt8<cl_int>(const Layout, const Transpose, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const QuantizedType, const cl_mem, const size_t, const size_t, const int,
+                                                const QuantizedType, const cl_mem, const size_t, const size_t, const int,
+                                                cl_mem, const size_t, const size_t, const int,
+                                                const float, const EpilogueMode, const cl_mem, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmInt8<float>(const Layout, const Transpose, const Transpose,
+                                               const size_t, const size_t, const size_t,
+                                               const QuantizedType, const cl_mem, const size_t, const size_t, const int,
+                                               const QuantizedType, const cl_mem, const size_t, const size_t, const int,
+                                               cl_mem, const size_t, const size_t, const int,
+                                               const float, const EpilogueMode, const cl_mem, const size_t,
+                                               cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Complex GEMM using the 3M method: CGEMM3M/ZGEMM3M
+template <typename T>
+StatusCode Gemm3m(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                  const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                  cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm3m<T>(queue_cpp, event);
+    routine.DoGemm3m(layout, a_transpose, b_transpose,
+                     m, n, k,
+                     alpha,
+                     Buffer<T>(a_buffer), a_offset, a_ld,
+                     Buffer<T>(b_buffer), b_offset, b_ld,
+                     beta,
+                     Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Gemm3m<float2>(const Layout, const Transpose, const Transpose,
+                                              const size_t, const size_t, const size_t,
+                                              const float2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const float2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm3m<double2>(const Layout, const Transpose, const Transpose,
+                                               const size_t, const size_t, const size_t,
+                                               const double2,
+                                               const cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               const double2,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Blocked Cholesky factorisation: SPOTRF/DPOTRF/CPOTRF/ZPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpotrf<T>(queue_cpp, event);
+    routine.DoPotrf(layout, triangle, n,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<unsigned int>(info_buffer), info_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Potrf<float>(const Layout, const Triangle, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<double>(const Layout, const Triangle, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<float2>(const Layout, const Triangle, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<double2>(const Layout, const Triangle, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Solver based on the Cholesky factorisation: SPOTRS/DPOTRS/CPOTRS/ZPOTRS
+template <typename T>
+StatusCode Potrs(const Layout layout, const Triangle triangle, const size_t n, const size_t nrhs,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpotrf<T>(queue_cpp, event);
+    routine.DoPotrs(layout, triangle, n, nrhs,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<T>(b_buffer), b_offset, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Potrs<float>(const Layout, const Triangle, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrs<double>(const Layout, const Triangle, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrs<float2>(const Layout, const Triangle, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrs<double2>(const Layout, const Triangle, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Blocked LU factorisation with partial pivoting: SGETRF/DGETRF/CGETRF/ZGETRF
+template <typename T>
+StatusCode Getrf(const Layout layout, const size_t m, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem ipiv_buffer, const size_t ipiv_offset,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgetrf<T>(queue_cpp, event);
+    routine.DoGetrf(layout, m, n,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<unsigned int>(ipiv_buffer), ipiv_offset,
+                    Buffer<unsigned int>(info_buffer), info_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Getrf<float>(const Layout, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrf<double>(const Layout, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrf<float2>(const Layout, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrf<double2>(const Layout, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Solver based on the LU factorisation: SGETRS/DGETRS/CGETRS/ZGETRS
+template <typename T>
+StatusCode Getrs(const Layout layout, const Transpose a_transpose, const size_t n, const size_t nrhs,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgetrf<T>(queue_cpp, event);
+    routine.DoGetrs(layout, a_transpose, n, nrhs,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<unsigned int>(ipiv_buffer), ipiv_offset,
+                    Buffer<T>(b_buffer), b_offset, b_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Getrs<float>(const Layout, const Transpose, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrs<double>(const Layout, const Transpose, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrs<float2>(const Layout, const Transpose, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrs<double2>(const Layout, const Transpose, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+
 // =================================================================================================
 } // namespace clblast
@@ -3779,6 +3779,1154 @@ CLBlastStatusCode CLBlastHgemmBatched(const CLBlastLayout layout, const CLBlastT
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// GEMM
+CLBlastStatusCode CLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  float2{beta.s[0], beta.s[1]},
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  double2{beta.s[0], beta.s[1]},
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const cl_half beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  beta,
+                                  c_buffer, c_offset, c_ld, c_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMM
+CLBlastStatusCode CLBlastSgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t *ms, const size_t *ns, const size_t *ks,
+                                             const float *alphas,
+                                             const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                             const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                             const float *betas,
+                                             cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGroupedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  ms, ns, ks,
+                                  alphas_cpp.data(),
+                                  a_buffer, a_offsets, a_lds,
+                                  b_buffer, b_offsets, b_lds,
+                                  betas_cpp.data(),
+                                  c_buffer, c_offsets, c_lds,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t *ms, const size_t *ns, const size_t *ks,
+                                             const double *alphas,
+                                             const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                             const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                             const double *betas,
+                                             cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGroupedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  ms, ns, ks,
+                                  alphas_cpp.data(),
+                                  a_buffer, a_offsets, a_lds,
+                                  b_buffer, b_offsets, b_lds,
+                                  betas_cpp.data(),
+                                  c_buffer, c_offsets, c_lds,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t *ms, const size_t *ns, const size_t *ks,
+                                             const cl_float2 *alphas,
+                                             const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                             const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                             const cl_float2 *betas,
+                                             cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGroupedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  ms, ns, ks,
+                                  alphas_cpp.data(),
+                                  a_buffer, a_offsets, a_lds,
+                                  b_buffer, b_offsets, b_lds,
+                                  betas_cpp.data(),
+                                  c_buffer, c_offsets, c_lds,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t *ms, const size_t *ns, const size_t *ks,
+                                             const cl_double2 *alphas,
+                                             const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                             const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                             const cl_double2 *betas,
+                                             cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGroupedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  ms, ns, ks,
+                                  alphas_cpp.data(),
+                                  a_buffer, a_offsets, a_lds,
+                                  b_buffer, b_offsets, b_lds,
+                                  betas_cpp.data(),
+                                  c_buffer, c_offsets, c_lds,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmGroupedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t *ms, const size_t *ns, const size_t *ks,
+                                             const cl_half *alphas,
+                                             const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                             const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                             const cl_half *betas,
+                                             cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGroupedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  ms, ns, ks,
+                                  alphas_cpp.data(),
+                                  a_buffer, a_offsets, a_lds,
+                                  b_buffer, b_offsets, b_lds,
+                                  betas_cpp.data(),
+                                  c_buffer, c_offsets, c_lds,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPY
+CLBlastStatusCode CLBlastSaxpyBatchedDevice(const size_t n,
+                                            const cl_mem alphas,
+                                            const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                            cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyBatched<float>(n,
+                                  alphas,
+                                  x_buffer, x_offsets, x_inc,
+                                  y_buffer, y_offsets, y_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpyBatchedDevice(const size_t n,
+                                            const cl_mem alphas,
+                                            const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                            cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyBatched<double>(n,
+                                   alphas,
+                                   x_buffer, x_offsets, x_inc,
+                                   y_buffer, y_offsets, y_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpyBatchedDevice(const size_t n,
+                                            const cl_mem alphas,
+                                            const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                            cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyBatched<float2>(n,
+                                   alphas,
+                                   x_buffer, x_offsets, x_inc,
+                                   y_buffer, y_offsets, y_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpyBatchedDevice(const size_t n,
+                                            const cl_mem alphas,
+                                            const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                            cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyBatched<double2>(n,
+                                    alphas,
+                                    x_buffer, x_offsets, x_inc,
+                                    y_buffer, y_offsets, y_inc,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpyBatchedDevice(const size_t n,
+                                            const cl_mem alphas,
+                                            const cl_mem x_buffer, const cl_mem x_offsets, const size_t x_inc,
+                                            cl_mem y_buffer, const cl_mem y_offsets, const size_t y_inc,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyBatched<half>(n,
+                                 alphas,
+                                 x_buffer, x_offsets, x_inc,
+                                 y_buffer, y_offsets, y_inc,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMM
+CLBlastStatusCode CLBlastSgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas,
+                                            const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                            const cl_mem betas,
+                                            cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched<float>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alphas,
+                                  a_buffer, a_offsets, a_ld,
+                                  b_buffer, b_offsets, b_ld,
+                                  betas,
+                                  c_buffer, c_offsets, c_ld,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas,
+                                            const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                            const cl_mem betas,
+                                            cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched<double>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   alphas,
+                                   a_buffer, a_offsets, a_ld,
+                                   b_buffer, b_offsets, b_ld,
+                                   betas,
+                                   c_buffer, c_offsets, c_ld,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas,
+                                            const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                            const cl_mem betas,
+                                            cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched<float2>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   alphas,
+                                   a_buffer, a_offsets, a_ld,
+                                   b_buffer, b_offsets, b_ld,
+                                   betas,
+                                   c_buffer, c_offsets, c_ld,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas,
+                                            const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                            const cl_mem betas,
+                                            cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched<double2>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    static_cast<clblast::Transpose>(b_transpose),
+                                    m, n, k,
+                                    alphas,
+                                    a_buffer, a_offsets, a_ld,
+                                    b_buffer, b_offsets, b_ld,
+                                    betas,
+                                    c_buffer, c_offsets, c_ld,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas,
+                                            const cl_mem a_buffer, const cl_mem a_offsets, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets, const size_t b_ld,
+                                            const cl_mem betas,
+                                            cl_mem c_buffer, const cl_mem c_offsets, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched<half>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 static_cast<clblast::Transpose>(b_transpose),
+                                 m, n, k,
+                                 alphas,
+                                 a_buffer, a_offsets, a_ld,
+                                 b_buffer, b_offsets, b_ld,
+                                 betas,
+                                 c_buffer, c_offsets, c_ld,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMV
+CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const float *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const double *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_float2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_double2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_half *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_half *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMV
+CLBlastStatusCode CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const float beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const double beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_float2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  float2{beta.s[0], beta.s[1]},
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_double2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  double2{beta.s[0], beta.s[1]},
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_half beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRSV
+CLBlastStatusCode CLBlastStrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t n,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvBatched<float>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  n,
+                                  a_buffer, a_offsets, a_ld,
+                                  x_buffer, x_offsets, x_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t n,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvBatched<double>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Triangle>(triangle),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Diagonal>(diagonal),
+                                   n,
+                                   a_buffer, a_offsets, a_ld,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t n,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvBatched<float2>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Triangle>(triangle),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Diagonal>(diagonal),
+                                   n,
+                                   a_buffer, a_offsets, a_ld,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrsvBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t n,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvBatched<double2>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Triangle>(triangle),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    static_cast<clblast::Diagonal>(diagonal),
+                                    n,
+                                    a_buffer, a_offsets, a_ld,
+                                    x_buffer, x_offsets, x_inc,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRSV
+CLBlastStatusCode CLBlastStrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<float>(static_cast<clblast::Layout>(layout),
+                                         static_cast<clblast::Triangle>(triangle),
+                                         static_cast<clblast::Transpose>(a_transpose),
+                                         static_cast<clblast::Diagonal>(diagonal),
+                                         n,
+                                         a_buffer, a_offset, a_ld, a_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<double>(static_cast<clblast::Layout>(layout),
+                                          static_cast<clblast::Triangle>(triangle),
+                                          static_cast<clblast::Transpose>(a_transpose),
+                                          static_cast<clblast::Diagonal>(diagonal),
+                                          n,
+                                          a_buffer, a_offset, a_ld, a_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<float2>(static_cast<clblast::Layout>(layout),
+                                          static_cast<clblast::Triangle>(triangle),
+                                          static_cast<clblast::Transpose>(a_transpose),
+                                          static_cast<clblast::Diagonal>(diagonal),
+                                          n,
+                                          a_buffer, a_offset, a_ld, a_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrsvStridedBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t n,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsvStridedBatched<double2>(static_cast<clblast::Layout>(layout),
+                                           static_cast<clblast::Triangle>(triangle),
+                                           static_cast<clblast::Transpose>(a_transpose),
+                                           static_cast<clblast::Diagonal>(diagonal),
+                                           n,
+                                           a_buffer, a_offset, a_ld, a_stride,
+                                           x_buffer, x_offset, x_inc, x_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRSM
+CLBlastStatusCode CLBlastStrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrsmBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                      const size_t m, const size_t n,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Diagonal>(diagonal),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// TRSM
+CLBlastStatusCode CLBlastStrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZtrsmStridedBatched(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrsmStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Diagonal>(diagonal),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  b_buffer, b_offset, b_ld, b_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // =================================================================================================
 
 // Clears the cache of stored binaries
@@ -3816,3 +4964,558 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
 }
 
 // =================================================================================================
+
+// Sets the level of validation of the OpenCL buffer arguments
+CLBlastStatusCode PUBLIC_API CLBlastSetBufferValidation(const CLBlastBufferValidation validation) {
+  try {
+    const auto validation_cpp = static_cast<clblast::BufferValidation>(validation);
+    return static_cast<CLBlastStatusCode>(clblast::SetBufferValidation(validation_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Sets the accuracy mode of the routines
+CLBlastStatusCode PUBLIC_API CLBlastSetAccuracy(const CLBlastAccuracy accuracy) {
+  try {
+    const auto accuracy_cpp = static_cast<clblast::Accuracy>(accuracy);
+    return static_cast<CLBlastStatusCode>(clblast::SetAccuracy(accuracy_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// GEMM with a fused epilogue
+CLBlastStatusCode CLBlastSgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const float alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const float beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       const CLBlastEpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                       const CLBlastActivation activation, const float clip_min, const float clip_max,
+                                       const CLBlastEpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmEpilogue(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Transpose>(a_transpose),
+                            static_cast<clblast::Transpose>(b_transpose),
+                            m, n, k,
+                            alpha,
+                            a_buffer, a_offset, a_ld,
+                            b_buffer, b_offset, b_ld,
+                            beta,
+                            c_buffer, c_offset, c_ld,
+                            static_cast<clblast::EpilogueMode>(bias_mode), bias_buffer, bias_offset,
+                            static_cast<clblast::Activation>(activation), clip_min, clip_max,
+                            static_cast<clblast::EpilogueMode>(scale_mode), scale_buffer, scale_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const double alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const double beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       const CLBlastEpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                       const CLBlastActivation activation, const double clip_min, const double clip_max,
+                                       const CLBlastEpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmEpilogue(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Transpose>(a_transpose),
+                            static_cast<clblast::Transpose>(b_transpose),
+                            m, n, k,
+                            alpha,
+                            a_buffer, a_offset, a_ld,
+                            b_buffer, b_offset, b_ld,
+                            beta,
+                            c_buffer, c_offset, c_ld,
+                            static_cast<clblast::EpilogueMode>(bias_mode), bias_buffer, bias_offset,
+                            static_cast<clblast::Activation>(activation), clip_min, clip_max,
+                            static_cast<clblast::EpilogueMode>(scale_mode), scale_buffer, scale_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmEpilogue(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const cl_half alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const cl_half beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       const CLBlastEpilogueMode bias_mode, const cl_mem bias_buffer, const size_t bias_offset,
+                                       const CLBlastActivation activation, const cl_half clip_min, const cl_half clip_max,
+                                       const CLBlastEpilogueMode scale_mode, const cl_mem scale_buffer, const size_t scale_offset,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmEpilogue(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Transpose>(a_transpose),
+                            static_cast<clblast::Transpose>(b_transpose),
+                            m, n, k,
+                            alpha,
+                            a_buffer, a_offset, a_ld,
+                            b_buffer, b_offset, b_ld,
+                            beta,
+                            c_buffer, c_offset, c_ld,
+                            static_cast<clblast::EpilogueMode>(bias_mode), bias_buffer, bias_offset,
+                            static_cast<clblast::Activation>(activation), clip_min, clip_max,
+                            static_cast<clblast::EpilogueMode>(scale_mode), scale_buffer, scale_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+
+// =================================================================================================
+
+// Mixed-precision GEMM
+CLBlastStatusCode CLBlastHgemmMixed(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                    const size_t m, const size_t n, const size_t k,
+                                    const float alpha,
+                                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                    const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                    const float beta,
+                                    cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMixed<half>(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSgemmMixed(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                    const size_t m, const size_t n, const size_t k,
+                                    const float alpha,
+                                    const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                    const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                    const float beta,
+                                    cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmMixed<float>(static_cast<clblast::Layout>(layout),
+                                static_cast<clblast::Transpose>(a_transpose),
+                                static_cast<clblast::Transpose>(b_transpose),
+                                m, n, k,
+                                alpha,
+                                a_buffer, a_offset, a_ld,
+                                b_buffer, b_offset, b_ld,
+                                beta,
+                                c_buffer, c_offset, c_ld,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+
+// =================================================================================================
+
+// Quantised GEMM
+CLBlastStatusCode CLBlastGemmInt8(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const CLBlastQuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const int a_zero_point,
+                                  const CLBlastQuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const int b_zero_point,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  const int c_zero_point,
+                                  const float scale, const CLBlastEpilogueMode scale_mode,
+                                  const cl_mem scale_buffer, const size_t scale_offset,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmInt8<cl_char>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 static_cast<clblast::Transpose>(b_transpose),
+                                 m, n, k,
+                                 static_cast<clblast::QuantizedType>(a_type), a_buffer, a_offset, a_ld, a_zero_point,
+                                 static_cast<clblast::QuantizedType>(b_type), b_buffer, b_offset, b_ld, b_zero_point,
+                                 c_buffer, c_offset, c_ld, c_zero_point,
+                                 scale, static_cast<clblast::EpilogueMode>(scale_mode), scale_buffer, scale_offset,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastGemmInt8Int32(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const CLBlastQuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const int a_zero_point,
+                                       const CLBlastQuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const int b_zero_point,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       const int c_zero_point,
+                                       const float scale, const CLBlastEpilogueMode scale_mode,
+                                       const cl_mem scale_buffer, const size_t scale_offset,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmInt8<cl_int>(static_cast<clblast::Layout>(layout),
+                                static_cast<clblast::Transpose>(a_transpose),
+                                static_cast<clblast::Transpose>(b_transpose),
+                                m, n, k,
+                                static_cast<clblast::QuantizedType>(a_type), a_buffer, a_offset, a_ld, a_zero_point,
+                                static_cast<clblast::QuantizedType>(b_type), b_buffer, b_offset, b_ld, b_zero_point,
+                                c_buffer, c_offset, c_ld, c_zero_point,
+                                scale, static_cast<clblast::EpilogueMode>(scale_mode), scale_buffer, scale_offset,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastGemmInt8Float(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const CLBlastQuantizedType a_type, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const int a_zero_point,
+                                       const CLBlastQuantizedType b_type, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const int b_zero_point,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       const int c_zero_point,
+                                       const float scale, const CLBlastEpilogueMode scale_mode,
+                                       const cl_mem scale_buffer, const size_t scale_offset,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmInt8<float>(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Transpose>(a_transpose),
+                               static_cast<clblast::Transpose>(b_transpose),
+                               m, n, k,
+                               static_cast<clblast::QuantizedType>(a_type), a_buffer, a_offset, a_ld, a_zero_point,
+                               static_cast<clblast::QuantizedType>(b_type), b_buffer, b_offset, b_ld, b_zero_point,
+                               c_buffer, c_offset, c_ld, c_zero_point,
+                               scale, static_cast<clblast::EpilogueMode>(scale_mode), scale_buffer, scale_offset,
+                               queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+
+// =================================================================================================
+
+// Complex GEMM using the 3M method
+CLBlastStatusCode CLBlastCgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const cl_float2 alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                 const cl_float2 beta,
+                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm3m(static_cast<clblast::Layout>(layout),
+                      static_cast<clblast::Transpose>(a_transpose),
+                      static_cast<clblast::Transpose>(b_transpose),
+                      m, n, k,
+                      float2{alpha.s[0], alpha.s[1]},
+                      a_buffer, a_offset, a_ld,
+                      b_buffer, b_offset, b_ld,
+                      float2{beta.s[0], beta.s[1]},
+                      c_buffer, c_offset, c_ld,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemm3m(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 const cl_double2 alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                 const cl_double2 beta,
+                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm3m(static_cast<clblast::Layout>(layout),
+                      static_cast<clblast::Transpose>(a_transpose),
+                      static_cast<clblast::Transpose>(b_transpose),
+                      m, n, k,
+                      double2{alpha.s[0], alpha.s[1]},
+                      a_buffer, a_offset, a_ld,
+                      b_buffer, b_offset, b_ld,
+                      double2{beta.s[0], beta.s[1]},
+                      c_buffer, c_offset, c_ld,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Blocked Cholesky factorisation of a symmetric (Hermitian) positive-definite matrix. See the C++
+// API for more details.
+CLBlastStatusCode CLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Triangle>(triangle),
+                            n,
+                            a_buffer, a_offset, a_ld,
+                            info_buffer, info_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<float2>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<double2>(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              n,
+                              a_buffer, a_offset, a_ld,
+                              info_buffer, info_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Solver based on the Cholesky factorisation computed by the above routines
+CLBlastStatusCode CLBlastSpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrs<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Triangle>(triangle),
+                            n, nrhs,
+                            a_buffer, a_offset, a_ld,
+                            b_buffer, b_offset, b_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrs<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n, nrhs,
+                             a_buffer, a_offset, a_ld,
+                             b_buffer, b_offset, b_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrs<float2>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n, nrhs,
+                             a_buffer, a_offset, a_ld,
+                             b_buffer, b_offset, b_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZpotrs(const CLBlastLayout layout, const CLBlastTriangle triangle, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrs<double2>(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              n, nrhs,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Blocked LU factorisation with partial pivoting of a general matrix. See the C++ API for more
+// details.
+CLBlastStatusCode CLBlastSgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<float>(static_cast<clblast::Layout>(layout),
+                            m, n,
+                            a_buffer, a_offset, a_ld,
+                            ipiv_buffer, ipiv_offset,
+                            info_buffer, info_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<double>(static_cast<clblast::Layout>(layout),
+                             m, n,
+                             a_buffer, a_offset, a_ld,
+                             ipiv_buffer, ipiv_offset,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<float2>(static_cast<clblast::Layout>(layout),
+                             m, n,
+                             a_buffer, a_offset, a_ld,
+                             ipiv_buffer, ipiv_offset,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgetrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<double2>(static_cast<clblast::Layout>(layout),
+                              m, n,
+                              a_buffer, a_offset, a_ld,
+                              ipiv_buffer, ipiv_offset,
+                              info_buffer, info_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Solver based on the LU factorisation computed by the above routines
+CLBlastStatusCode CLBlastSgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrs<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Transpose>(a_transpose),
+                            n, nrhs,
+                            a_buffer, a_offset, a_ld,
+                            ipiv_buffer, ipiv_offset,
+                            b_buffer, b_offset, b_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrs<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             n, nrhs,
+                             a_buffer, a_offset, a_ld,
+                             ipiv_buffer, ipiv_offset,
+                             b_buffer, b_offset, b_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrs<float2>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             n, nrhs,
+                             a_buffer, a_offset, a_ld,
+                             ipiv_buffer, ipiv_offset,
+                             b_buffer, b_offset, b_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgetrs(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t n, const size_t nrhs,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrs<double2>(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, nrhs,
+                              a_buffer, a_offset, a_ld,
+                              ipiv_buffer, ipiv_offset,
+                              b_buffer, b_offset, b_ld,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
@@ -8,8 +8,9 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file contains the Netlib CBLAS implementations to the CLBlast BLAS routines, performing buffer
-// copies automatically and running on the default OpenCL platform and device. For full control over
-// performance, it is advised to use the regular clblast.h or clblast_c.h headers instead.
+// copies automatically and running on the default OpenCL platform and device. The OpenCL context,
+// queue and staging buffers are shared among all calls (see netlib_runtime.hpp). For full control
+// over performance, it is advised to use the regular clblast.h or clblast_c.h headers instead.
 //
 // =================================================================================================
 
@@ -17,20 +18,13 @@
 
 #include "clblast_netlib_c.h"
 #include "clblast.h"
+#include "netlib_runtime.hpp"
 #include "utilities/utilities.hpp"
 
 // Shortcuts to the clblast namespace
 using float2 = clblast::float2;
 using double2 = clblast::double2;
 
-// Helper function to get a default OpenCL platform and device
-clblast::Device get_device() {
-  auto platform_id = clblast::ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0});
-  auto device_id = clblast::ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0});
-  auto platform = clblast::Platform(platform_id);
-  return clblast::Device(platform, device_id);
-}
-
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -40,21 +34,16 @@ void cblas_srotg(float* sa,
                  float* sb,
                  float* sc,
                  float* ss) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto sa_size = 1;
   const auto sb_size = 1;
   const auto sc_size = 1;
   const auto ss_size = 1;
-  auto sa_buffer = clblast::Buffer<float>(context, sa_size);
-  auto sb_buffer = clblast::Buffer<float>(context, sb_size);
-  auto sc_buffer = clblast::Buffer<float>(context, sc_size);
-  auto ss_buffer = clblast::Buffer<float>(context, ss_size);
-  sa_buffer.Write(queue, sa_size, reinterpret_cast<float*>(sa));
-  sb_buffer.Write(queue, sb_size, reinterpret_cast<float*>(sb));
-  sc_buffer.Write(queue, sc_size, reinterpret_cast<float*>(sc));
-  ss_buffer.Write(queue, ss_size, reinterpret_cast<float*>(ss));
+  auto sa_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sa), sa_size);
+  auto sb_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sb), sb_size);
+  auto sc_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sc), sc_size);
+  auto ss_buffer = runtime.Upload<float>(reinterpret_cast<float*>(ss), ss_size);
   auto queue_cl = queue();
   auto s = clblast::Rotg<float>(sa_buffer(), 0,
                                 sb_buffer(), 0,
@@ -73,21 +62,16 @@ void cblas_drotg(double* sa,
                  double* sb,
                  double* sc,
                  double* ss) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto sa_size = 1;
   const auto sb_size = 1;
   const auto sc_size = 1;
   const auto ss_size = 1;
-  auto sa_buffer = clblast::Buffer<double>(context, sa_size);
-  auto sb_buffer = clblast::Buffer<double>(context, sb_size);
-  auto sc_buffer = clblast::Buffer<double>(context, sc_size);
-  auto ss_buffer = clblast::Buffer<double>(context, ss_size);
-  sa_buffer.Write(queue, sa_size, reinterpret_cast<double*>(sa));
-  sb_buffer.Write(queue, sb_size, reinterpret_cast<double*>(sb));
-  sc_buffer.Write(queue, sc_size, reinterpret_cast<double*>(sc));
-  ss_buffer.Write(queue, ss_size, reinterpret_cast<double*>(ss));
+  auto sa_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sa), sa_size);
+  auto sb_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sb), sb_size);
+  auto sc_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sc), sc_size);
+  auto ss_buffer = runtime.Upload<double>(reinterpret_cast<double*>(ss), ss_size);
   auto queue_cl = queue();
   auto s = clblast::Rotg<double>(sa_buffer(), 0,
                                  sb_buffer(), 0,
@@ -109,25 +93,19 @@ void cblas_srotmg(float* sd1,
                   float* sx1,
                   const float sy1,
                   float* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto sy1_size = 1;
   const auto sd1_size = 1;
   const auto sd2_size = 1;
   const auto sx1_size = 1;
   const auto sparam_size = 1;
-  auto sy1_buffer = clblast::Buffer<float>(context, sy1_size);
   float sy1_vec[1]; sy1_vec[0] = sy1;
-  auto sd1_buffer = clblast::Buffer<float>(context, sd1_size);
-  auto sd2_buffer = clblast::Buffer<float>(context, sd2_size);
-  auto sx1_buffer = clblast::Buffer<float>(context, sx1_size);
-  auto sparam_buffer = clblast::Buffer<float>(context, sparam_size);
-  sy1_buffer.Write(queue, sy1_size, reinterpret_cast<const float*>(sy1_vec));
-  sd1_buffer.Write(queue, sd1_size, reinterpret_cast<float*>(sd1));
-  sd2_buffer.Write(queue, sd2_size, reinterpret_cast<float*>(sd2));
-  sx1_buffer.Write(queue, sx1_size, reinterpret_cast<float*>(sx1));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<float*>(sparam));
+  auto sy1_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(sy1_vec), sy1_size);
+  auto sd1_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sd1), sd1_size);
+  auto sd2_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sd2), sd2_size);
+  auto sx1_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sx1), sx1_size);
+  auto sparam_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sparam), sparam_size);
   auto queue_cl = queue();
   auto s = clblast::Rotmg<float>(sd1_buffer(), 0,
                                  sd2_buffer(), 0,
@@ -148,25 +126,19 @@ void cblas_drotmg(double* sd1,
                   double* sx1,
                   const double sy1,
                   double* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto sy1_size = 1;
   const auto sd1_size = 1;
   const auto sd2_size = 1;
   const auto sx1_size = 1;
   const auto sparam_size = 1;
-  auto sy1_buffer = clblast::Buffer<double>(context, sy1_size);
   double sy1_vec[1]; sy1_vec[0] = sy1;
-  auto sd1_buffer = clblast::Buffer<double>(context, sd1_size);
-  auto sd2_buffer = clblast::Buffer<double>(context, sd2_size);
-  auto sx1_buffer = clblast::Buffer<double>(context, sx1_size);
-  auto sparam_buffer = clblast::Buffer<double>(context, sparam_size);
-  sy1_buffer.Write(queue, sy1_size, reinterpret_cast<const double*>(sy1_vec));
-  sd1_buffer.Write(queue, sd1_size, reinterpret_cast<double*>(sd1));
-  sd2_buffer.Write(queue, sd2_size, reinterpret_cast<double*>(sd2));
-  sx1_buffer.Write(queue, sx1_size, reinterpret_cast<double*>(sx1));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<double*>(sparam));
+  auto sy1_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(sy1_vec), sy1_size);
+  auto sd1_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sd1), sd1_size);
+  auto sd2_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sd2), sd2_size);
+  auto sx1_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sx1), sx1_size);
+  auto sparam_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sparam), sparam_size);
   auto queue_cl = queue();
   auto s = clblast::Rotmg<double>(sd1_buffer(), 0,
                                   sd2_buffer(), 0,
@@ -189,15 +161,12 @@ void cblas_srot(const int n,
                 float* y, const int y_inc,
                 const float cos,
                 const float sin) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Rot(n,
                         x_buffer(), 0, x_inc,
@@ -216,15 +185,12 @@ void cblas_drot(const int n,
                 double* y, const int y_inc,
                 const double cos,
                 const double sin) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Rot(n,
                         x_buffer(), 0, x_inc,
@@ -244,18 +210,14 @@ void cblas_srotm(const int n,
                  float* x, const int x_inc,
                  float* y, const int y_inc,
                  float* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto sparam_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto sparam_buffer = clblast::Buffer<float>(context, sparam_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<float*>(sparam));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
+  auto sparam_buffer = runtime.Upload<float>(reinterpret_cast<float*>(sparam), sparam_size);
   auto queue_cl = queue();
   auto s = clblast::Rotm<float>(n,
                                 x_buffer(), 0, x_inc,
@@ -273,18 +235,14 @@ void cblas_drotm(const int n,
                  double* x, const int x_inc,
                  double* y, const int y_inc,
                  double* sparam) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto sparam_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto sparam_buffer = clblast::Buffer<double>(context, sparam_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
-  sparam_buffer.Write(queue, sparam_size, reinterpret_cast<double*>(sparam));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
+  auto sparam_buffer = runtime.Upload<double>(reinterpret_cast<double*>(sparam), sparam_size);
   auto queue_cl = queue();
   auto s = clblast::Rotm<double>(n,
                                  x_buffer(), 0, x_inc,
@@ -303,15 +261,12 @@ void cblas_drotm(const int n,
 void cblas_sswap(const int n,
                  float* x, const int x_inc,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Swap<float>(n,
                                 x_buffer(), 0, x_inc,
@@ -326,15 +281,12 @@ void cblas_sswap(const int n,
 void cblas_dswap(const int n,
                  double* x, const int x_inc,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Swap<double>(n,
                                  x_buffer(), 0, x_inc,
@@ -349,15 +301,12 @@ void cblas_dswap(const int n,
 void cblas_cswap(const int n,
                  void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Swap<float2>(n,
                                  x_buffer(), 0, x_inc,
@@ -372,15 +321,12 @@ void cblas_cswap(const int n,
 void cblas_zswap(const int n,
                  void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Swap<double2>(n,
                                   x_buffer(), 0, x_inc,
@@ -397,13 +343,11 @@ void cblas_zswap(const int n,
 void cblas_sscal(const int n,
                  const float alpha,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -417,13 +361,11 @@ void cblas_sscal(const int n,
 void cblas_dscal(const int n,
                  const double alpha,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -437,13 +379,11 @@ void cblas_dscal(const int n,
 void cblas_cscal(const int n,
                  const void* alpha,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -457,13 +397,11 @@ void cblas_cscal(const int n,
 void cblas_zscal(const int n,
                  const void* alpha,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Scal(n,
                          alpha_cpp,
@@ -479,15 +417,12 @@ void cblas_zscal(const int n,
 void cblas_scopy(const int n,
                  const float* x, const int x_inc,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Copy<float>(n,
                                 x_buffer(), 0, x_inc,
@@ -501,15 +436,12 @@ void cblas_scopy(const int n,
 void cblas_dcopy(const int n,
                  const double* x, const int x_inc,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Copy<double>(n,
                                  x_buffer(), 0, x_inc,
@@ -523,15 +455,12 @@ void cblas_dcopy(const int n,
 void cblas_ccopy(const int n,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Copy<float2>(n,
                                  x_buffer(), 0, x_inc,
@@ -545,15 +474,12 @@ void cblas_ccopy(const int n,
 void cblas_zcopy(const int n,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Copy<double2>(n,
                                   x_buffer(), 0, x_inc,
@@ -570,16 +496,13 @@ void cblas_saxpy(const int n,
                  const float alpha,
                  const float* x, const int x_inc,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -595,16 +518,13 @@ void cblas_daxpy(const int n,
                  const double alpha,
                  const double* x, const int x_inc,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -620,16 +540,13 @@ void cblas_caxpy(const int n,
                  const void* alpha,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -645,16 +562,13 @@ void cblas_zaxpy(const int n,
                  const void* alpha,
                  const void* x, const int x_inc,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Axpy(n,
                          alpha_cpp,
@@ -671,17 +585,14 @@ void cblas_zaxpy(const int n,
 float cblas_sdot(const int n,
                  const float* x, const int x_inc,
                  const float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto dot_buffer = clblast::Buffer<float>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(y), y_size);
+  auto dot_buffer = runtime.Acquire<float>(dot_size);
   auto queue_cl = queue();
   auto s = clblast::Dot<float>(n,
                                dot_buffer(), 0,
@@ -698,17 +609,14 @@ float cblas_sdot(const int n,
 double cblas_ddot(const int n,
                   const double* x, const int x_inc,
                   const double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto dot_buffer = clblast::Buffer<double>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(y), y_size);
+  auto dot_buffer = runtime.Acquire<double>(dot_size);
   auto queue_cl = queue();
   auto s = clblast::Dot<double>(n,
                                 dot_buffer(), 0,
@@ -728,17 +636,14 @@ void cblas_cdotu_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<float2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(y), y_size);
+  auto dot_buffer = runtime.Acquire<float2>(dot_size);
   auto queue_cl = queue();
   auto s = clblast::Dotu<float2>(n,
                                  dot_buffer(), 0,
@@ -754,17 +659,14 @@ void cblas_zdotu_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<double2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(y), y_size);
+  auto dot_buffer = runtime.Acquire<double2>(dot_size);
   auto queue_cl = queue();
   auto s = clblast::Dotu<double2>(n,
                                   dot_buffer(), 0,
@@ -782,17 +684,14 @@ void cblas_cdotc_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<float2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(y), y_size);
+  auto dot_buffer = runtime.Acquire<float2>(dot_size);
   auto queue_cl = queue();
   auto s = clblast::Dotc<float2>(n,
                                  dot_buffer(), 0,
@@ -808,17 +707,14 @@ void cblas_zdotc_sub(const int n,
                      const void* x, const int x_inc,
                      const void* y, const int y_inc,
                      void* dot) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto dot_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto dot_buffer = clblast::Buffer<double2>(context, dot_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(y), y_size);
+  auto dot_buffer = runtime.Acquire<double2>(dot_size);
   auto queue_cl = queue();
   auto s = clblast::Dotc<double2>(n,
                                   dot_buffer(), 0,
@@ -834,14 +730,12 @@ void cblas_zdotc_sub(const int n,
 // NRM2
 float cblas_snrm2(const int n,
                   const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<float>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto nrm2_buffer = runtime.Acquire<float>(nrm2_size);
   auto queue_cl = queue();
   auto s = clblast::Nrm2<float>(n,
                                 nrm2_buffer(), 0,
@@ -856,14 +750,12 @@ float cblas_snrm2(const int n,
 }
 double cblas_dnrm2(const int n,
                    const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<double>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto nrm2_buffer = runtime.Acquire<double>(nrm2_size);
   auto queue_cl = queue();
   auto s = clblast::Nrm2<double>(n,
                                  nrm2_buffer(), 0,
@@ -878,14 +770,12 @@ double cblas_dnrm2(const int n,
 }
 float cblas_scnrm2(const int n,
                   const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<float2>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto nrm2_buffer = runtime.Acquire<float2>(nrm2_size);
   auto queue_cl = queue();
   auto s = clblast::Nrm2<float2>(n,
                                  nrm2_buffer(), 0,
@@ -900,14 +790,12 @@ float cblas_scnrm2(const int n,
 }
 double cblas_dznrm2(const int n,
                    const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto nrm2_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto nrm2_buffer = clblast::Buffer<double2>(context, nrm2_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto nrm2_buffer = runtime.Acquire<double2>(nrm2_size);
   auto queue_cl = queue();
   auto s = clblast::Nrm2<double2>(n,
                                   nrm2_buffer(), 0,
@@ -924,14 +812,12 @@ double cblas_dznrm2(const int n,
 // ASUM
 float cblas_sasum(const int n,
                   const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto asum_buffer = clblast::Buffer<float>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto asum_buffer = runtime.Acquire<float>(asum_size);
   auto queue_cl = queue();
   auto s = clblast::Asum<float>(n,
                                 asum_buffer(), 0,
@@ -946,14 +832,12 @@ float cblas_sasum(const int n,
 }
 double cblas_dasum(const int n,
                    const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto asum_buffer = clblast::Buffer<double>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto asum_buffer = runtime.Acquire<double>(asum_size);
   auto queue_cl = queue();
   auto s = clblast::Asum<double>(n,
                                  asum_buffer(), 0,
@@ -968,14 +852,12 @@ double cblas_dasum(const int n,
 }
 float cblas_scasum(const int n,
                   const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto asum_buffer = clblast::Buffer<float2>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto asum_buffer = runtime.Acquire<float2>(asum_size);
   auto queue_cl = queue();
   auto s = clblast::Asum<float2>(n,
                                  asum_buffer(), 0,
@@ -990,14 +872,12 @@ float cblas_scasum(const int n,
 }
 double cblas_dzasum(const int n,
                    const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto asum_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto asum_buffer = clblast::Buffer<double2>(context, asum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto asum_buffer = runtime.Acquire<double2>(asum_size);
   auto queue_cl = queue();
   auto s = clblast::Asum<double2>(n,
                                   asum_buffer(), 0,
@@ -1014,14 +894,12 @@ double cblas_dzasum(const int n,
 // SUM
 float cblas_ssum(const int n,
                  const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto sum_buffer = clblast::Buffer<float>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto sum_buffer = runtime.Acquire<float>(sum_size);
   auto queue_cl = queue();
   auto s = clblast::Sum<float>(n,
                                sum_buffer(), 0,
@@ -1036,14 +914,12 @@ float cblas_ssum(const int n,
 }
 double cblas_dsum(const int n,
                   const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto sum_buffer = clblast::Buffer<double>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto sum_buffer = runtime.Acquire<double>(sum_size);
   auto queue_cl = queue();
   auto s = clblast::Sum<double>(n,
                                 sum_buffer(), 0,
@@ -1058,14 +934,12 @@ double cblas_dsum(const int n,
 }
 float cblas_scsum(const int n,
                  const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto sum_buffer = clblast::Buffer<float2>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto sum_buffer = runtime.Acquire<float2>(sum_size);
   auto queue_cl = queue();
   auto s = clblast::Sum<float2>(n,
                                 sum_buffer(), 0,
@@ -1080,14 +954,12 @@ float cblas_scsum(const int n,
 }
 double cblas_dzsum(const int n,
                   const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto sum_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto sum_buffer = clblast::Buffer<double2>(context, sum_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto sum_buffer = runtime.Acquire<double2>(sum_size);
   auto queue_cl = queue();
   auto s = clblast::Sum<double2>(n,
                                  sum_buffer(), 0,
@@ -1104,14 +976,12 @@ double cblas_dzsum(const int n,
 // AMAX
 int cblas_isamax(const int n,
                 const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Amax<float>(n,
                                 imax_buffer(), 0,
@@ -1126,14 +996,12 @@ int cblas_isamax(const int n,
 }
 int cblas_idamax(const int n,
                 const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Amax<double>(n,
                                  imax_buffer(), 0,
@@ -1148,14 +1016,12 @@ int cblas_idamax(const int n,
 }
 int cblas_icamax(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Amax<float2>(n,
                                  imax_buffer(), 0,
@@ -1170,14 +1036,12 @@ int cblas_icamax(const int n,
 }
 int cblas_izamax(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Amax<double2>(n,
                                   imax_buffer(), 0,
@@ -1194,14 +1058,12 @@ int cblas_izamax(const int n,
 // AMIN
 int cblas_isamin(const int n,
                 const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Amin<float>(n,
                                 imin_buffer(), 0,
@@ -1216,14 +1078,12 @@ int cblas_isamin(const int n,
 }
 int cblas_idamin(const int n,
                 const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Amin<double>(n,
                                  imin_buffer(), 0,
@@ -1238,14 +1098,12 @@ int cblas_idamin(const int n,
 }
 int cblas_icamin(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Amin<float2>(n,
                                  imin_buffer(), 0,
@@ -1260,14 +1118,12 @@ int cblas_icamin(const int n,
 }
 int cblas_izamin(const int n,
                 const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Amin<double2>(n,
                                   imin_buffer(), 0,
@@ -1284,14 +1140,12 @@ int cblas_izamin(const int n,
 // MAX
 int cblas_ismax(const int n,
                const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Max<float>(n,
                                imax_buffer(), 0,
@@ -1306,14 +1160,12 @@ int cblas_ismax(const int n,
 }
 int cblas_idmax(const int n,
                const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Max<double>(n,
                                 imax_buffer(), 0,
@@ -1328,14 +1180,12 @@ int cblas_idmax(const int n,
 }
 int cblas_icmax(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Max<float2>(n,
                                 imax_buffer(), 0,
@@ -1350,14 +1200,12 @@ int cblas_icmax(const int n,
 }
 int cblas_izmax(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imax_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imax_buffer = clblast::Buffer<int>(context, imax_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto imax_buffer = runtime.Acquire<int>(imax_size);
   auto queue_cl = queue();
   auto s = clblast::Max<double2>(n,
                                  imax_buffer(), 0,
@@ -1374,14 +1222,12 @@ int cblas_izmax(const int n,
 // MIN
 int cblas_ismin(const int n,
                const float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Min<float>(n,
                                imin_buffer(), 0,
@@ -1396,14 +1242,12 @@ int cblas_ismin(const int n,
 }
 int cblas_idmin(const int n,
                const double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Min<double>(n,
                                 imin_buffer(), 0,
@@ -1418,14 +1262,12 @@ int cblas_idmin(const int n,
 }
 int cblas_icmin(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Min<float2>(n,
                                 imin_buffer(), 0,
@@ -1440,14 +1282,12 @@ int cblas_icmin(const int n,
 }
 int cblas_izmin(const int n,
                const void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto x_size = n * x_inc;
   const auto imin_size = 1;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto imin_buffer = clblast::Buffer<int>(context, imin_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto imin_buffer = runtime.Acquire<int>(imin_size);
   auto queue_cl = queue();
   auto s = clblast::Min<double2>(n,
                                  imin_buffer(), 0,
@@ -1473,20 +1313,26 @@ void cblas_sgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
+  if (runtime.PipelinedGemv<float>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   m, n,
+                                   alpha_cpp,
+                                   reinterpret_cast<const float*>(a), a_ld,
+                                   reinterpret_cast<const float*>(x), x_inc,
+                                   beta_cpp,
+                                   reinterpret_cast<float*>(y), y_inc)) {
+    return;
+  }
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1509,20 +1355,26 @@ void cblas_dgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
+  if (runtime.PipelinedGemv<double>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    m, n,
+                                    alpha_cpp,
+                                    reinterpret_cast<const double*>(a), a_ld,
+                                    reinterpret_cast<const double*>(x), x_inc,
+                                    beta_cpp,
+                                    reinterpret_cast<double*>(y), y_inc)) {
+    return;
+  }
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1545,20 +1397,26 @@ void cblas_cgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  if (runtime.PipelinedGemv<float2>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    m, n,
+                                    alpha_cpp,
+                                    reinterpret_cast<const float2*>(a), a_ld,
+                                    reinterpret_cast<const float2*>(x), x_inc,
+                                    beta_cpp,
+                                    reinterpret_cast<float2*>(y), y_inc)) {
+    return;
+  }
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1581,20 +1439,26 @@ void cblas_zgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  if (runtime.PipelinedGemv<double2>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     m, n,
+                                     alpha_cpp,
+                                     reinterpret_cast<const double2*>(a), a_ld,
+                                     reinterpret_cast<const double2*>(x), x_inc,
+                                     beta_cpp,
+                                     reinterpret_cast<double2*>(y), y_inc)) {
+    return;
+  }
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1619,20 +1483,16 @@ void cblas_sgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1655,20 +1515,16 @@ void cblas_dgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1691,20 +1547,16 @@ void cblas_cgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1727,20 +1579,16 @@ void cblas_zgbmv(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto x_size = (a_transpose != CLBlastTransposeNo) ? m * x_inc : n * x_inc;
   const auto y_size = (a_transpose != CLBlastTransposeNo) ? n * y_inc : m * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Gbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -1765,20 +1613,16 @@ void cblas_chemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Hemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1801,20 +1645,16 @@ void cblas_zhemv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Hemv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1839,20 +1679,16 @@ void cblas_chbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Hbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1875,20 +1711,16 @@ void cblas_zhbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Hbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1913,20 +1745,16 @@ void cblas_chpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto ap_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Hpmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1949,20 +1777,16 @@ void cblas_zhpmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* beta,
                  void* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto ap_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Hpmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -1987,20 +1811,16 @@ void cblas_ssymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Symv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2023,20 +1843,16 @@ void cblas_dsymv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Symv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2061,20 +1877,16 @@ void cblas_ssbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Sbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2097,20 +1909,16 @@ void cblas_dsbmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Sbmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2135,20 +1943,16 @@ void cblas_sspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float beta,
                  float* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto ap_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<float*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Spmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2171,20 +1975,16 @@ void cblas_dspmv(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double beta,
                  double* y, const int y_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto ap_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<double*>(y), y_size);
   auto queue_cl = queue();
   auto s = clblast::Spmv(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -2206,15 +2006,12 @@ void cblas_strmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trmv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2233,15 +2030,12 @@ void cblas_dtrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trmv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2260,15 +2054,12 @@ void cblas_ctrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trmv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2287,15 +2078,12 @@ void cblas_ztrmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trmv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2316,15 +2104,12 @@ void cblas_stbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbmv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2343,15 +2128,12 @@ void cblas_dtbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbmv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2370,15 +2152,12 @@ void cblas_ctbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbmv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2397,15 +2176,12 @@ void cblas_ztbmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbmv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2426,15 +2202,12 @@ void cblas_stpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* ap,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto ap_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpmv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2453,15 +2226,12 @@ void cblas_dtpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const double* ap,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto ap_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpmv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2480,15 +2250,12 @@ void cblas_ctpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto ap_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpmv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2507,15 +2274,12 @@ void cblas_ztpmv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto ap_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpmv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2536,15 +2300,12 @@ void cblas_strsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trsv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2563,15 +2324,12 @@ void cblas_dtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trsv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2590,15 +2348,12 @@ void cblas_ctrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trsv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2617,15 +2372,12 @@ void cblas_ztrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Trsv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2646,15 +2398,12 @@ void cblas_stbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const float* a, const int a_ld,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbsv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2673,15 +2422,12 @@ void cblas_dtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const double* a, const int a_ld,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbsv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2700,15 +2446,12 @@ void cblas_ctbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbsv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2727,15 +2470,12 @@ void cblas_ztbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n, const int k,
                  const void* a, const int a_ld,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto a_size = n * a_ld;
   const auto x_size = n * x_inc;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tbsv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2756,15 +2496,12 @@ void cblas_stpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const float* ap,
                  float* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto ap_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<float*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpsv<float>(static_cast<clblast::Layout>(layout),
                                 static_cast<clblast::Triangle>(triangle),
@@ -2783,15 +2520,12 @@ void cblas_dtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const double* ap,
                  double* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto ap_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<double*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpsv<double>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2810,15 +2544,12 @@ void cblas_ctpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const float2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto ap_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpsv<float2>(static_cast<clblast::Layout>(layout),
                                  static_cast<clblast::Triangle>(triangle),
@@ -2837,15 +2568,12 @@ void cblas_ztpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const int n,
                  const void* ap,
                  void* x, const int x_inc) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto ap_size = ((n*(n+1)) / 2);
   const auto x_size = n * x_inc;
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<const double2*>(ap));
-  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto ap_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(ap), ap_size);
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(x), x_size);
   auto queue_cl = queue();
   auto s = clblast::Tpsv<double2>(static_cast<clblast::Layout>(layout),
                                   static_cast<clblast::Triangle>(triangle),
@@ -2868,19 +2596,15 @@ void cblas_sger(const CLBlastLayout layout,
                 const float* x, const int x_inc,
                 const float* y, const int y_inc,
                 float* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(y), y_size);
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<float*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Ger(static_cast<clblast::Layout>(layout),
                         m, n,
@@ -2900,19 +2624,15 @@ void cblas_dger(const CLBlastLayout layout,
                 const double* x, const int x_inc,
                 const double* y, const int y_inc,
                 double* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(y), y_size);
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<double*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Ger(static_cast<clblast::Layout>(layout),
                         m, n,
@@ -2934,19 +2654,15 @@ void cblas_cgeru(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(y), y_size);
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Geru(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -2966,19 +2682,15 @@ void cblas_zgeru(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(y), y_size);
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Geru(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -3000,19 +2712,15 @@ void cblas_cgerc(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(y), y_size);
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Gerc(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -3032,19 +2740,15 @@ void cblas_zgerc(const CLBlastLayout layout,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = m * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(y), y_size);
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Gerc(static_cast<clblast::Layout>(layout),
                          m, n,
@@ -3065,16 +2769,13 @@ void cblas_cher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const void* x, const int x_inc,
                 void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Her(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3093,16 +2794,13 @@ void cblas_zher(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const double alpha,
                 const void* x, const int x_inc,
                 void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Her(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3123,16 +2821,13 @@ void cblas_chpr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const void* x, const int x_inc,
                 void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float2*>(ap));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto ap_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Hpr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3151,16 +2846,13 @@ void cblas_zhpr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const double alpha,
                 const void* x, const int x_inc,
                 void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double2*>(ap));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto ap_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Hpr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3182,19 +2874,15 @@ void cblas_cher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float2*>(a));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(y), y_size);
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Her2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3215,19 +2903,15 @@ void cblas_zher2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double2*>(a));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(y), y_size);
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Her2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3250,19 +2934,15 @@ void cblas_chpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float2>(context, x_size);
-  auto y_buffer = clblast::Buffer<float2>(context, y_size);
-  auto ap_buffer = clblast::Buffer<float2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float2*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float2*>(ap));
+  auto x_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(x), x_size);
+  auto y_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(y), y_size);
+  auto ap_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Hpr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3283,19 +2963,15 @@ void cblas_zhpr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const void* x, const int x_inc,
                  const void* y, const int y_inc,
                  void* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double2>(context, x_size);
-  auto y_buffer = clblast::Buffer<double2>(context, y_size);
-  auto ap_buffer = clblast::Buffer<double2>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double2*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double2*>(ap));
+  auto x_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(x), x_size);
+  auto y_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(y), y_size);
+  auto ap_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Hpr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3317,16 +2993,13 @@ void cblas_ssyr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const float* x, const int x_inc,
                 float* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<float*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Syr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3345,16 +3018,13 @@ void cblas_dsyr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const double alpha,
                 const double* x, const int x_inc,
                 double* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<double*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Syr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3375,16 +3045,13 @@ void cblas_sspr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const float alpha,
                 const float* x, const int x_inc,
                 float* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float*>(ap));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto ap_buffer = runtime.Upload<float>(reinterpret_cast<float*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Spr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3403,16 +3070,13 @@ void cblas_dspr(const CLBlastLayout layout, const CLBlastTriangle triangle,
                 const double alpha,
                 const double* x, const int x_inc,
                 double* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double*>(ap));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto ap_buffer = runtime.Upload<double>(reinterpret_cast<double*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Spr(static_cast<clblast::Layout>(layout),
                         static_cast<clblast::Triangle>(triangle),
@@ -3434,19 +3098,15 @@ void cblas_ssyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float* y, const int y_inc,
                  float* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<float*>(a));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(y), y_size);
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<float*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Syr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3467,19 +3127,15 @@ void cblas_dsyr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double* y, const int y_inc,
                  double* a, const int a_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto a_size = n * a_ld;
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  a_buffer.Write(queue, a_size, reinterpret_cast<double*>(a));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(y), y_size);
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<double*>(a), a_size);
   auto queue_cl = queue();
   auto s = clblast::Syr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3502,19 +3158,15 @@ void cblas_sspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const float* x, const int x_inc,
                  const float* y, const int y_inc,
                  float* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<float>(context, x_size);
-  auto y_buffer = clblast::Buffer<float>(context, y_size);
-  auto ap_buffer = clblast::Buffer<float>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const float*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<float*>(ap));
+  auto x_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(x), x_size);
+  auto y_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(y), y_size);
+  auto ap_buffer = runtime.Upload<float>(reinterpret_cast<float*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Spr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3535,19 +3187,15 @@ void cblas_dspr2(const CLBlastLayout layout, const CLBlastTriangle triangle,
                  const double* x, const int x_inc,
                  const double* y, const int y_inc,
                  double* ap) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto x_size = n * x_inc;
   const auto y_size = n * y_inc;
   const auto ap_size = ((n*(n+1)) / 2);
-  auto x_buffer = clblast::Buffer<double>(context, x_size);
-  auto y_buffer = clblast::Buffer<double>(context, y_size);
-  auto ap_buffer = clblast::Buffer<double>(context, ap_size);
-  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
-  y_buffer.Write(queue, y_size, reinterpret_cast<const double*>(y));
-  ap_buffer.Write(queue, ap_size, reinterpret_cast<double*>(ap));
+  auto x_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(x), x_size);
+  auto y_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(y), y_size);
+  auto ap_buffer = runtime.Upload<double>(reinterpret_cast<double*>(ap), ap_size);
   auto queue_cl = queue();
   auto s = clblast::Spr2(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3575,20 +3223,27 @@ void cblas_sgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const float* b, const int b_ld,
                  const float beta,
                  float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
+  if (runtime.PipelinedGemm<float>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   alpha_cpp,
+                                   reinterpret_cast<const float*>(a), a_ld,
+                                   reinterpret_cast<const float*>(b), b_ld,
+                                   beta_cpp,
+                                   reinterpret_cast<float*>(c), c_ld)) {
+    return;
+  }
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(b), b_size);
+  auto c_buffer = runtime.Upload<float>(reinterpret_cast<float*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3612,20 +3267,27 @@ void cblas_dgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const double* b, const int b_ld,
                  const double beta,
                  double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
+  if (runtime.PipelinedGemm<double>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    static_cast<clblast::Transpose>(b_transpose),
+                                    m, n, k,
+                                    alpha_cpp,
+                                    reinterpret_cast<const double*>(a), a_ld,
+                                    reinterpret_cast<const double*>(b), b_ld,
+                                    beta_cpp,
+                                    reinterpret_cast<double*>(c), c_ld)) {
+    return;
+  }
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(b), b_size);
+  auto c_buffer = runtime.Upload<double>(reinterpret_cast<double*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3649,20 +3311,27 @@ void cblas_cgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  if (runtime.PipelinedGemm<float2>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    static_cast<clblast::Transpose>(b_transpose),
+                                    m, n, k,
+                                    alpha_cpp,
+                                    reinterpret_cast<const float2*>(a), a_ld,
+                                    reinterpret_cast<const float2*>(b), b_ld,
+                                    beta_cpp,
+                                    reinterpret_cast<float2*>(c), c_ld)) {
+    return;
+  }
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3686,20 +3355,27 @@ void cblas_zgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  if (runtime.PipelinedGemm<double2>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     alpha_cpp,
+                                     reinterpret_cast<const double2*>(a), a_ld,
+                                     reinterpret_cast<const double2*>(b), b_ld,
+                                     beta_cpp,
+                                     reinterpret_cast<double2*>(c), c_ld)) {
+    return;
+  }
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? k * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Gemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Transpose>(a_transpose),
@@ -3725,20 +3401,16 @@ void cblas_ssymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const float* b, const int b_ld,
                  const float beta,
                  float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(b), b_size);
+  auto c_buffer = runtime.Upload<float>(reinterpret_cast<float*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3762,20 +3434,16 @@ void cblas_dsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const double* b, const int b_ld,
                  const double beta,
                  double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(b), b_size);
+  auto c_buffer = runtime.Upload<double>(reinterpret_cast<double*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3799,20 +3467,16 @@ void cblas_csymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3836,20 +3500,16 @@ void cblas_zsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Symm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3875,20 +3535,16 @@ void cblas_chemm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Hemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3912,20 +3568,16 @@ void cblas_zhemm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* b, const int b_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : ((side == CLBlastSideLeft) ? m : n) * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? ((side == CLBlastSideLeft) ? m : n) * b_ld : n * b_ld;
   const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Hemm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -3950,17 +3602,14 @@ void cblas_ssyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const float* a, const int a_ld,
                  const float beta,
                  float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto c_buffer = runtime.Upload<float>(reinterpret_cast<float*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -3982,17 +3631,14 @@ void cblas_dsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const double* a, const int a_ld,
                  const double beta,
                  double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto c_buffer = runtime.Upload<double>(reinterpret_cast<double*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4014,17 +3660,14 @@ void cblas_csyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4046,17 +3689,14 @@ void cblas_zsyrk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const void* beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syrk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4080,17 +3720,14 @@ void cblas_cherk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const float beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Herk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4112,17 +3749,14 @@ void cblas_zherk(const CLBlastLayout layout, const CLBlastTriangle triangle, con
                  const void* a, const int a_ld,
                  const double beta,
                  void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Herk(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Triangle>(triangle),
@@ -4147,20 +3781,16 @@ void cblas_ssyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const float* b, const int b_ld,
                   const float beta,
                   float* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  auto c_buffer = clblast::Buffer<float>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(b), b_size);
+  auto c_buffer = runtime.Upload<float>(reinterpret_cast<float*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4184,20 +3814,16 @@ void cblas_dsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const double* b, const int b_ld,
                   const double beta,
                   double* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  auto c_buffer = clblast::Buffer<double>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(b), b_size);
+  auto c_buffer = runtime.Upload<double>(reinterpret_cast<double*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4221,20 +3847,16 @@ void cblas_csyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const void* beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4258,20 +3880,16 @@ void cblas_zsyr2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const void* beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Syr2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4297,20 +3915,16 @@ void cblas_cher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const float beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  auto c_buffer = clblast::Buffer<float2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(b), b_size);
+  auto c_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Her2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4334,20 +3948,16 @@ void cblas_zher2k(const CLBlastLayout layout, const CLBlastTriangle triangle, co
                   const void* b, const int b_ld,
                   const double beta,
                   void* c, const int c_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto beta_cpp = beta;
   const auto a_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * a_ld : k * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && ab_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && ab_transpose == CLBlastTransposeNo)) ? n * b_ld : k * b_ld;
   const auto c_size = n * c_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  auto c_buffer = clblast::Buffer<double2>(context, c_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
-  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(b), b_size);
+  auto c_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(c), c_size);
   auto queue_cl = queue();
   auto s = clblast::Her2k(static_cast<clblast::Layout>(layout),
                           static_cast<clblast::Triangle>(triangle),
@@ -4371,16 +3981,13 @@ void cblas_strmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const float alpha,
                  const float* a, const int a_ld,
                  float* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float*>(b));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = runtime.Upload<float>(reinterpret_cast<float*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4402,16 +4009,13 @@ void cblas_dtrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const double alpha,
                  const double* a, const int a_ld,
                  double* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double*>(b));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = runtime.Upload<double>(reinterpret_cast<double*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4433,16 +4037,13 @@ void cblas_ctrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float2*>(b));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4464,16 +4065,13 @@ void cblas_ztrmm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double2*>(b));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trmm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4497,16 +4095,13 @@ void cblas_strsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const float alpha,
                  const float* a, const int a_ld,
                  float* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float*>(b));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = runtime.Upload<float>(reinterpret_cast<float*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4528,16 +4123,13 @@ void cblas_dtrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const double alpha,
                  const double* a, const int a_ld,
                  double* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double*>(b));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = runtime.Upload<double>(reinterpret_cast<double*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4559,16 +4151,13 @@ void cblas_ctrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float2*>(b));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4590,16 +4179,13 @@ void cblas_ztrsm(const CLBlastLayout layout, const CLBlastSide side, const CLBla
                  const void* alpha,
                  const void* a, const int a_ld,
                  void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto a_size = (side == CLBlastSideLeft) ? m * a_ld : n * a_ld;
   const auto b_size = (layout == CLBlastLayoutRowMajor) ? m * b_ld : n * b_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double2*>(b));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Trsm(static_cast<clblast::Layout>(layout),
                          static_cast<clblast::Side>(side),
@@ -4627,16 +4213,13 @@ void cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
                      const float alpha,
                      const float* a, const int a_ld,
                      float* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<float>(context, a_size);
-  auto b_buffer = clblast::Buffer<float>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float*>(b));
+  auto a_buffer = runtime.Upload<float>(reinterpret_cast<const float*>(a), a_size);
+  auto b_buffer = runtime.Upload<float>(reinterpret_cast<float*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4655,16 +4238,13 @@ void cblas_domatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
                      const double alpha,
                      const double* a, const int a_ld,
                      double* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = alpha;
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<double>(context, a_size);
-  auto b_buffer = clblast::Buffer<double>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double*>(b));
+  auto a_buffer = runtime.Upload<double>(reinterpret_cast<const double*>(a), a_size);
+  auto b_buffer = runtime.Upload<double>(reinterpret_cast<double*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4683,16 +4263,13 @@ void cblas_comatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
                      const void* alpha,
                      const void* a, const int a_ld,
                      void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<float2>(context, a_size);
-  auto b_buffer = clblast::Buffer<float2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<float2*>(b));
+  auto a_buffer = runtime.Upload<float2>(reinterpret_cast<const float2*>(a), a_size);
+  auto b_buffer = runtime.Upload<float2>(reinterpret_cast<float2*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4711,16 +4288,13 @@ void cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
                      const void* alpha,
                      const void* a, const int a_ld,
                      void* b, const int b_ld) {
-  auto device = get_device();
-  auto context = clblast::Context(device);
-  auto queue = clblast::Queue(context, device);
+  auto &runtime = clblast::NetlibRuntime::Instance();
+  const auto &queue = runtime.GetQueue();
   const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
   const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
   const auto b_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? n * b_ld : m * b_ld;
-  auto a_buffer = clblast::Buffer<double2>(context, a_size);
-  auto b_buffer = clblast::Buffer<double2>(context, b_size);
-  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
-  b_buffer.Write(queue, b_size, reinterpret_cast<double2*>(b));
+  auto a_buffer = runtime.Upload<double2>(reinterpret_cast<const double2*>(a), a_size);
+  auto b_buffer = runtime.Upload<double2>(reinterpret_cast<double2*>(b), b_size);
   auto queue_cl = queue();
   auto s = clblast::Omatcopy(static_cast<clblast::Layout>(layout),
                              static_cast<clblast::Transpose>(a_transpose),
@@ -4734,5 +4308,17 @@ void cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
   }
   b_buffer.Read(queue, b_size, reinterpret_cast<double2*>(b));
 }
+// =================================================================================================
+
+// Management of pinned host arrays
+void CLBlastNetlibPin(const void* host, const size_t bytes) {
+  clblast::NetlibRuntime::Instance().Pin(host, bytes);
+}
+void CLBlastNetlibInvalidate(const void* host) {
+  clblast::NetlibRuntime::Instance().Invalidate(host);
+}
+void CLBlastNetlibUnpin(const void* host) {
+  clblast::NetlibRuntime::Instance().Unpin(host);
+}
 
 // =================================================================================================
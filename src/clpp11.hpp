@@ -273,6 +273,12 @@ class Device {
   unsigned long MaxAllocSize() const {
     return static_cast<unsigned long>(GetInfo<cl_ulong>(CL_DEVICE_MAX_MEM_ALLOC_SIZE));
   }
+  bool HasUnifiedMemory() const {
+    return GetInfo<cl_bool>(CL_DEVICE_HOST_UNIFIED_MEMORY) == CL_TRUE;
+  }
+  size_t MemBaseAddrAlign() const { // in bytes
+    return static_cast<size_t>(GetInfo<cl_uint>(CL_DEVICE_MEM_BASE_ADDR_ALIGN)) / 8;
+  }
   size_t MemoryClock() const { return 0; } // Not exposed in OpenCL
   size_t MemoryBusWidth() const { return 0; } // Not exposed in OpenCL
 
@@ -576,6 +582,17 @@ class Buffer {
     queue.Finish();
   }
 
+  // Constructs a new read-only buffer holding a copy of a host-container. The copy is made upon
+  // creation, so no command-queue is involved and no previously enqueued work is waited for.
+  explicit Buffer(const Context &context, const std::vector<T> &host):
+      buffer_(new cl_mem, [](cl_mem* m) { CheckError(clReleaseMemObject(*m)); delete m; }),
+      access_(BufferAccess::kReadOnly) {
+    auto status = CL_SUCCESS;
+    *buffer_ = clCreateBuffer(context(), CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                              host.size()*sizeof(T), const_cast<T*>(host.data()), &status);
+    CLError::Check(status, "clCreateBuffer");
+  }
+
   // Copies from device to host: reading the device buffer a-synchronously
   void ReadAsync(const Queue &queue, const size_t size, T* host, const size_t offset = 0) const {
     if (access_ == BufferAccess::kWriteOnly) {
@@ -654,6 +671,19 @@ class Buffer {
     queue.Finish();
   }
 
+  // As above, but a-synchronously with an event and a list of events to wait for before starting
+  void CopyToAsync(const Queue &queue, const size_t size, const Buffer<T> &destination,
+                   EventPointer event, const std::vector<Event> &waitForEvents) const {
+    auto waitForEventsPlain = std::vector<cl_event>();
+    for (auto &waitEvent : waitForEvents) {
+      if (waitEvent()) { waitForEventsPlain.push_back(waitEvent()); }
+    }
+    CheckError(clEnqueueCopyBuffer(queue(), *buffer_, destination(), 0, 0, size*sizeof(T),
+                                   static_cast<cl_uint>(waitForEventsPlain.size()),
+                                   !waitForEventsPlain.empty() ? waitForEventsPlain.data() : nullptr,
+                                   event));
+  }
+
   // Retrieves the actual allocated size in bytes
   size_t GetSize() const {
     const auto bytes = sizeof(size_t);
@@ -41,7 +41,7 @@ const Database::DatabaseEntry XgerApple = {
   "Xger", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } } } } }
 };
 const Database::DatabaseEntry XtrsvApple = {
-  "Xtrsv", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"TRSV_BLOCK_SIZE",32} } } } } }
+  "Xtrsv", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",0} } } } } }
 };
 const Database::DatabaseEntry XgemmApple = {
   "Xgemm", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWG",1}, {"KWI",1}, {"MDIMA",1}, {"MDIMC",1}, {"MWG",1}, {"NDIMB",1}, {"NDIMC",1}, {"NWG",1}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } } } } }
@@ -49,6 +49,18 @@ const Database::DatabaseEntry XgemmApple = {
 const Database::DatabaseEntry XgemmDirectApple = {
   "XgemmDirect", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWID",1}, {"MDIMAD",1}, {"MDIMCD",1}, {"NDIMBD",1}, {"NDIMCD",1}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",1} } } } } }
 };
+const Database::DatabaseEntry XgemmBatchedApple = {
+  "XgemmBatched", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWG",1}, {"KWI",1}, {"MDIMA",1}, {"MDIMC",1}, {"MWG",1}, {"NDIMB",1}, {"NDIMC",1}, {"NWG",1}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } } } } }
+};
+const Database::DatabaseEntry XgemmDirectBatchedApple = {
+  "XgemmDirectBatched", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWID",1}, {"MDIMAD",1}, {"MDIMCD",1}, {"NDIMBD",1}, {"NDIMCD",1}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",1} } } } } }
+};
+const Database::DatabaseEntry XgemmMixedApple = {
+  "XgemmMixed", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWIX",1}, {"MDIMCX",1}, {"NDIMCX",1}, {"PADX",0}, {"WGX",1} } } } } }
+};
+const Database::DatabaseEntry XgemmInt8Apple = {
+  "XgemmInt8", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWIQ",1}, {"MDIMCQ",1}, {"NDIMCQ",1}, {"PADQ",0}, {"WGQ",1} } } } } }
+};
 const Database::DatabaseEntry CopyApple = {
   "Copy", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"COPY_DIMX",1}, {"COPY_DIMY",1}, {"COPY_VW",1}, {"COPY_WPT",1} } } } } }
 };
@@ -62,7 +74,7 @@ const Database::DatabaseEntry PadtransposeApple = {
   "Padtranspose", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"PADTRA_PAD",0}, {"PADTRA_TILE",1}, {"PADTRA_WPT",1} } } } } }
 };
 const Database::DatabaseEntry InvertApple = {
-  "Invert", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"INTERNAL_BLOCK_SIZE",16} } } } } }
+  "Invert", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"INTERNAL_BLOCK_SIZE",16}, {"TRSM_BLOCK_SIZE",64} } } } } }
 };
 
 // =================================================================================================
@@ -25,6 +25,10 @@
 #include "database/kernels/xtrsv.hpp"
 #include "database/kernels/xgemm.hpp"
 #include "database/kernels/xgemm_direct.hpp"
+#include "database/kernels/xgemm_batched.hpp"
+#include "database/kernels/xgemm_direct_batched.hpp"
+#include "database/kernels/xgemm_mixed.hpp"
+#include "database/kernels/xgemm_int8.hpp"
 #include "database/kernels/copy.hpp"
 #include "database/kernels/pad.hpp"
 #include "database/kernels/transpose.hpp"
@@ -56,6 +60,12 @@ const std::vector<Database::DatabaseEntry> Database::database = std::vector<Data
   // database::XgemmDouble, database::XgemmComplexSingle, database::XgemmComplexDouble,
   database::XgemmDirectHalf, database::XgemmDirectSingle, 
   // database::XgemmDirectDouble, database::XgemmDirectComplexSingle, database::XgemmDirectComplexDouble,
+  database::XgemmBatchedHalf, database::XgemmBatchedSingle,
+  // database::XgemmBatchedDouble, database::XgemmBatchedComplexSingle, database::XgemmBatchedComplexDouble,
+  database::XgemmDirectBatchedHalf, database::XgemmDirectBatchedSingle,
+  // database::XgemmDirectBatchedDouble, database::XgemmDirectBatchedComplexSingle, database::XgemmDirectBatchedComplexDouble,
+  database::XgemmMixedSingle,
+  database::XgemmInt8Single,
   database::CopyHalf, database::CopySingle, 
   // database::CopyDouble, database::CopyComplexSingle, database::CopyComplexDouble,
   database::PadHalf, database::PadSingle, 
@@ -67,12 +77,25 @@ const std::vector<Database::DatabaseEntry> Database::database = std::vector<Data
   database::InvertHalf, database::InvertSingle, 
   // database::InvertDouble, database::InvertComplexSingle, database::InvertComplexDouble,
   database::KernelSelectionHalf, database::KernelSelectionSingle, 
-  // database::KernelSelectionDouble, database::KernelSelectionComplexSingle, database::KernelSelectionComplexDouble
+  // database::KernelSelectionDouble, database::KernelSelectionComplexSingle, database::KernelSelectionComplexDouble,
+  database::KernelSelectionBatchedHalf, database::KernelSelectionBatchedSingle,
+  // database::KernelSelectionBatchedDouble, database::KernelSelectionBatchedComplexSingle, database::KernelSelectionBatchedComplexDouble,
+  database::KernelSelectionSmallBatchedHalf, database::KernelSelectionSmallBatchedSingle,
+  // database::KernelSelectionSmallBatchedDouble, database::KernelSelectionSmallBatchedComplexSingle, database::KernelSelectionSmallBatchedComplexDouble,
+  database::KernelSelectionSplitKHalf, database::KernelSelectionSplitKSingle,
+  // database::KernelSelectionSplitKDouble, database::KernelSelectionSplitKComplexSingle, database::KernelSelectionSplitKComplexDouble,
+  database::KernelSelectionStreamKHalf, database::KernelSelectionStreamKSingle,
+  // database::KernelSelectionStreamKDouble, database::KernelSelectionStreamKComplexSingle, database::KernelSelectionStreamKComplexDouble,
+  database::KernelSelectionTrmmHalf, database::KernelSelectionTrmmSingle,
+  // database::KernelSelectionTrmmDouble, database::KernelSelectionTrmmComplexSingle, database::KernelSelectionTrmmComplexDouble,
+  database::KernelSelectionStrassenHalf, database::KernelSelectionStrassenSingle,
+  // database::KernelSelectionStrassenDouble, database::KernelSelectionStrassenComplexSingle, database::KernelSelectionStrassenComplexDouble
 };
 const std::vector<Database::DatabaseEntry> Database::apple_cpu_fallback = std::vector<Database::DatabaseEntry>{
   database::XaxpyApple, database::XdotApple,
   database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgerApple, database::XtrsvApple,
-  database::XgemmApple, database::XgemmDirectApple,
+  database::XgemmApple, database::XgemmDirectApple, database::XgemmBatchedApple, database::XgemmDirectBatchedApple,
+  database::XgemmMixedApple, database::XgemmInt8Apple,
   database::CopyApple, database::PadApple, database::TransposeApple, database::PadtransposeApple,
   database::InvertApple
 };
@@ -10,7 +10,26 @@
 // This determines when to switch between the direct (for small sizes) and in-direct GEMM kernel
 // with pre/post-processing kernels (for larger sizes). These can be set in a similar way as for the
 // regular kernel tuning parameters: they can be specific for a certain vendor or device or can use
-// some common default values.
+// some common default values. The batched GEMM routine has its own threshold, which applies to the
+// total amount of work of all batches together. Its values are placeholders until the batched
+// kernels are tuned: they follow the regular thresholds, except that the Intel GPUs do not use the
+// in-direct kernel for tiny batches. The 'KernelSelectionSmallBatched' entry sets up the batched
+// GEMM kernels for tiny matrices, which are used if m, n and k are at most
+// XGEMM_SMALL_BATCHED_MAX_SIZE (at most 32) and which run XGEMM_SMALL_BATCHED_WGS threads per
+// work-group (zero for either disables these kernels). The 'KernelSelectionSplitK' entry sets up
+// the split-K version of GEMM for small m and n but large k, which targets
+// XGEMM_SPLITK_GROUPS_PER_UNIT work-groups per compute unit, each computing a part of the
+// k-dimension of at least XGEMM_SPLITK_MIN_SIZE (zero for either disables split-K). The
+// 'KernelSelectionStreamK' entry sets up the stream-K version of the in-direct kernel, which is
+// used instead of the regular version if the tiles of C fill at most XGEMM_STREAMK_MAX_WAVES waves
+// of work-groups over all compute units, the last of which is incomplete (zero disables stream-K).
+// GPUs use it for up to two waves, for which the incomplete last wave leaves the largest share of
+// the compute units idle. It is disabled for the other devices. The 'KernelSelectionTrmm' entry
+// sets the size TRMM_BLOCK_SIZE down to which TRMM recursively splits the triangular matrix, after
+// which the diagonal blocks are multiplied as regular matrices. The 'KernelSelectionStrassen' entry
+// sets the minimum size XGEMM_STRASSEN_MIN_SIZE of m, n, and k for which real single and
+// double-precision GEMMs apply a level of Strassen-Winograd recursion when reduced accuracy is
+// enabled (see the SetAccuracy function). Zero disables Strassen-Winograd.
 //
 // =================================================================================================
 
@@ -131,6 +150,446 @@ const Database::DatabaseEntry KernelSelectionComplexDouble = {
   }
 };
 
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionBatchedHalf = {
+  "KernelSelectionBatched", Precision::kHalf, {
+    { // Intel GPUs
+      kDeviceTypeGPU, "Intel", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",256*256*256} } },
+      }
+    },
+    { // NVIDIA GPUs
+      kDeviceTypeGPU, "NVIDIA", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",512*512*512} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionBatchedSingle = {
+  "KernelSelectionBatched", Precision::kSingle, {
+    { // Intel GPUs
+      kDeviceTypeGPU, "Intel", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",256*256*256} } },
+      }
+    },
+    { // NVIDIA GPUs
+      kDeviceTypeGPU, "NVIDIA", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+      }
+    },
+    { // ARM GPUs
+      kDeviceTypeGPU, "ARM", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",128*128*128} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",512*512*512} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionBatchedComplexSingle = {
+  "KernelSelectionBatched", Precision::kComplexSingle, {
+    { // Intel GPUs
+      kDeviceTypeGPU, "Intel", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",256*256*256} } },
+      }
+    },
+    { // NVIDIA GPUs
+      kDeviceTypeGPU, "NVIDIA", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",512*512*512} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionBatchedDouble = {
+  "KernelSelectionBatched", Precision::kDouble, {
+    { // Intel GPUs
+      kDeviceTypeGPU, "Intel", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",256*256*256} } },
+      }
+    },
+    { // NVIDIA GPUs
+      kDeviceTypeGPU, "NVIDIA", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",512*512*512} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionBatchedComplexDouble = {
+  "KernelSelectionBatched", Precision::kComplexDouble, {
+    { // Intel GPUs
+      kDeviceTypeGPU, "Intel", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",256*256*256} } },
+      }
+    },
+    { // NVIDIA GPUs
+      kDeviceTypeGPU, "NVIDIA", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",1280*1280*1280} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_BATCHED_MIN_INDIRECT_SIZE",512*512*512} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSmallBatchedHalf = {
+  "KernelSelectionSmallBatched", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SMALL_BATCHED_MAX_SIZE",32}, {"XGEMM_SMALL_BATCHED_WGS",64} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSmallBatchedSingle = {
+  "KernelSelectionSmallBatched", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SMALL_BATCHED_MAX_SIZE",32}, {"XGEMM_SMALL_BATCHED_WGS",64} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSmallBatchedComplexSingle = {
+  "KernelSelectionSmallBatched", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SMALL_BATCHED_MAX_SIZE",32}, {"XGEMM_SMALL_BATCHED_WGS",64} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSmallBatchedDouble = {
+  "KernelSelectionSmallBatched", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SMALL_BATCHED_MAX_SIZE",32}, {"XGEMM_SMALL_BATCHED_WGS",64} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSmallBatchedComplexDouble = {
+  "KernelSelectionSmallBatched", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SMALL_BATCHED_MAX_SIZE",32}, {"XGEMM_SMALL_BATCHED_WGS",64} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSplitKHalf = {
+  "KernelSelectionSplitK", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SPLITK_GROUPS_PER_UNIT",2}, {"XGEMM_SPLITK_MIN_SIZE",256} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSplitKSingle = {
+  "KernelSelectionSplitK", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SPLITK_GROUPS_PER_UNIT",2}, {"XGEMM_SPLITK_MIN_SIZE",256} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSplitKComplexSingle = {
+  "KernelSelectionSplitK", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SPLITK_GROUPS_PER_UNIT",2}, {"XGEMM_SPLITK_MIN_SIZE",256} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSplitKDouble = {
+  "KernelSelectionSplitK", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SPLITK_GROUPS_PER_UNIT",2}, {"XGEMM_SPLITK_MIN_SIZE",256} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionSplitKComplexDouble = {
+  "KernelSelectionSplitK", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_SPLITK_GROUPS_PER_UNIT",2}, {"XGEMM_SPLITK_MIN_SIZE",256} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStreamKHalf = {
+  "KernelSelectionStreamK", Precision::kHalf, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",2} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",0} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStreamKSingle = {
+  "KernelSelectionStreamK", Precision::kSingle, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",2} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",0} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStreamKComplexSingle = {
+  "KernelSelectionStreamK", Precision::kComplexSingle, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",2} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",0} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStreamKDouble = {
+  "KernelSelectionStreamK", Precision::kDouble, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",2} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",0} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStreamKComplexDouble = {
+  "KernelSelectionStreamK", Precision::kComplexDouble, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",2} } },
+      }
+    },
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STREAMK_MAX_WAVES",0} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionTrmmHalf = {
+  "KernelSelectionTrmm", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"TRMM_BLOCK_SIZE",128} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionTrmmSingle = {
+  "KernelSelectionTrmm", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"TRMM_BLOCK_SIZE",128} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionTrmmComplexSingle = {
+  "KernelSelectionTrmm", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"TRMM_BLOCK_SIZE",128} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionTrmmDouble = {
+  "KernelSelectionTrmm", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"TRMM_BLOCK_SIZE",128} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionTrmmComplexDouble = {
+  "KernelSelectionTrmm", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"TRMM_BLOCK_SIZE",128} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStrassenHalf = {
+  "KernelSelectionStrassen", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STRASSEN_MIN_SIZE",4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStrassenSingle = {
+  "KernelSelectionStrassen", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STRASSEN_MIN_SIZE",4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStrassenComplexSingle = {
+  "KernelSelectionStrassen", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STRASSEN_MIN_SIZE",4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStrassenDouble = {
+  "KernelSelectionStrassen", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STRASSEN_MIN_SIZE",4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry KernelSelectionStrassenComplexDouble = {
+  "KernelSelectionStrassen", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"XGEMM_STRASSEN_MIN_SIZE",4096} } },
+      }
+    },
+  }
+};
+
 // =================================================================================================
 } // namespace database
 } // namespace clblast
@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// Tuning parameters for the diagonal matrix inversion kernels
+// Tuning parameters for the diagonal matrix inversion kernels and for the TRSM block size
 //
 // =================================================================================================
 
@@ -19,7 +19,7 @@ const Database::DatabaseEntry InvertHalf = {
   "Invert", Precision::kHalf, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16}, {"TRSM_BLOCK_SIZE",64} } },
       }
     },
   }
@@ -31,7 +31,7 @@ const Database::DatabaseEntry InvertSingle = {
   "Invert", Precision::kSingle, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16}, {"TRSM_BLOCK_SIZE",64} } },
       }
     },
   }
@@ -43,7 +43,7 @@ const Database::DatabaseEntry InvertComplexSingle = {
   "Invert", Precision::kComplexSingle, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16}, {"TRSM_BLOCK_SIZE",64} } },
       }
     },
   }
@@ -55,7 +55,7 @@ const Database::DatabaseEntry InvertDouble = {
   "Invert", Precision::kDouble, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16}, {"TRSM_BLOCK_SIZE",64} } },
       }
     },
   }
@@ -67,7 +67,7 @@ const Database::DatabaseEntry InvertComplexDouble = {
   "Invert", Precision::kComplexDouble, {
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
+        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16}, {"TRSM_BLOCK_SIZE",64} } },
       }
     },
   }
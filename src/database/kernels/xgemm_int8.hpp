@@ -0,0 +1,32 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with best-found tuning parameters for the 'XgemmInt8' kernels.
+// The quantised kernel reads 8-bit integers and accumulates in 32-bit integers, but it is compiled
+// in single precision for its scaling factors, so its parameters are stored under single precision.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+const Database::DatabaseEntry XgemmInt8Single = {
+  "XgemmInt8", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {"KWIQ",2}, {"MDIMCQ",8}, {"NDIMCQ",8}, {"PADQ",1}, {"WGQ",32} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
@@ -8,6 +8,8 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file populates the database with best-found tuning parameters for the 'Xtrsv' kernels.
+// TRSV_SINGLE_MAX is not tuned: systems up to this size are solved by a single work-group, so the
+// values are kept small to leave larger systems to the block-algorithm which uses the whole device.
 //
 // =================================================================================================
 
@@ -17,9 +19,14 @@ namespace database {
 
 const Database::DatabaseEntry XtrsvHalf = {
   "Xtrsv", Precision::kHalf, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",256} } },
+      }
+    },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",128} } },
       }
     },
   }
@@ -29,9 +36,14 @@ const Database::DatabaseEntry XtrsvHalf = {
 
 const Database::DatabaseEntry XtrsvSingle = {
   "Xtrsv", Precision::kSingle, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",256} } },
+      }
+    },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",128} } },
       }
     },
   }
@@ -41,9 +53,14 @@ const Database::DatabaseEntry XtrsvSingle = {
 
 const Database::DatabaseEntry XtrsvComplexSingle = {
   "Xtrsv", Precision::kComplexSingle, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",256} } },
+      }
+    },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",128} } },
       }
     },
   }
@@ -53,9 +70,14 @@ const Database::DatabaseEntry XtrsvComplexSingle = {
 
 const Database::DatabaseEntry XtrsvDouble = {
   "Xtrsv", Precision::kDouble, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",256} } },
+      }
+    },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",128} } },
       }
     },
   }
@@ -65,9 +87,14 @@ const Database::DatabaseEntry XtrsvDouble = {
 
 const Database::DatabaseEntry XtrsvComplexDouble = {
   "Xtrsv", Precision::kComplexDouble, {
+    { // GPUs
+      kDeviceTypeGPU, "default", {
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",256} } },
+      }
+    },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
+        { "default",                                         { {"TRSV_BLOCK_SIZE",32}, {"TRSV_SINGLE_MAX",128} } },
       }
     },
   }
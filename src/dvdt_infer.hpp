@@ -20,7 +20,8 @@ namespace clblast{
                     const T beta, const size_t c_offset, const size_t c_ld, int * flag){
 
       std::vector<std::string> routines_vett = {"Copy","Pad","Transpose",
-                      "Padtranspose","KernelSelection"};
+                      "Padtranspose","KernelSelection","KernelSelectionSplitK",
+                      "KernelSelectionStreamK","KernelSelectionStrassen"};
 
       routines_vett.push_back("XgemmDirect");
       routines_vett.push_back("Xgemm");
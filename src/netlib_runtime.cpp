@@ -0,0 +1,519 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the NetlibRuntime class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "cache.hpp"
+#include "netlib_runtime.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// Helper function to get the default OpenCL platform and device
+Device GetNetlibDevice() {
+  const auto platform_id = ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0});
+  const auto device_id = ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0});
+  const auto platform = Platform(platform_id);
+  return Device(platform, device_id);
+}
+
+// Computes a fingerprint of the contents of a host array. This is a 64-bit FNV-1a style hash which
+// processes whole words at a time: hashing the full array runs at host memory bandwidth, which is
+// much cheaper than a transfer to the device.
+uint64_t Fingerprint(const void* host, const size_t bytes) {
+  const auto data = static_cast<const unsigned char*>(host);
+  auto hash = uint64_t{14695981039346656037ULL};
+  const auto num_words = bytes / sizeof(uint64_t);
+  for (auto i = size_t{0}; i < num_words; ++i) {
+    auto word = uint64_t{0};
+    std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash = (hash ^ word) * uint64_t{1099511628211ULL};
+  }
+  for (auto i = num_words * sizeof(uint64_t); i < bytes; ++i) {
+    hash = (hash ^ data[i]) * uint64_t{1099511628211ULL};
+  }
+  return hash;
+}
+
+// Uploads the full contents of a pinned host array to its device copy
+void UploadPin(const Queue &queue, NetlibPin &pin) {
+  CheckError(clEnqueueWriteBuffer(queue(), pin.memory, CL_TRUE, 0, pin.bytes, pin.host, 0,
+                                  nullptr, nullptr));
+  pin.fingerprint = Fingerprint(pin.host, pin.bytes);
+  pin.valid = true;
+}
+
+// The location of a sub-matrix of a host matrix as an OpenCL rectangular region. With column-major
+// storage the rows are contiguous in memory, with row-major storage the columns are. On the device
+// the sub-matrix is stored compactly, with the returned leading dimension.
+struct SubMatrix {
+  size_t host_origin[3];
+  size_t region[3];
+  size_t host_row_pitch;
+  size_t device_ld;
+};
+template <typename T>
+SubMatrix GetSubMatrix(const Layout layout, const size_t ld, const size_t row, const size_t col,
+                       const size_t rows, const size_t cols) {
+  const auto col_major = (layout == Layout::kColMajor);
+  const auto contiguous_offset = (col_major) ? row : col;
+  const auto contiguous_size = (col_major) ? rows : cols;
+  const auto strided_offset = (col_major) ? col : row;
+  const auto strided_size = (col_major) ? cols : rows;
+  return SubMatrix{{contiguous_offset * sizeof(T), strided_offset, 0},
+                   {contiguous_size * sizeof(T), strided_size, 1},
+                   ld * sizeof(T), contiguous_size};
+}
+
+// Copies a sub-matrix from the host into a compact device buffer or vice-versa (a-synchronously)
+const size_t kDeviceOrigin[3] = {0, 0, 0};
+void WriteSubMatrix(const Queue &queue, const cl_mem buffer, const SubMatrix &sub, const void* host,
+                    Event &event, const std::vector<cl_event> &wait_list = {}) {
+  CheckError(clEnqueueWriteBufferRect(queue(), buffer, CL_FALSE, kDeviceOrigin, sub.host_origin,
+                                      sub.region, sub.region[0], 0, sub.host_row_pitch, 0, host,
+                                      static_cast<cl_uint>(wait_list.size()),
+                                      wait_list.empty() ? nullptr : wait_list.data(),
+                                      event.pointer()));
+}
+void ReadSubMatrix(const Queue &queue, const cl_mem buffer, const SubMatrix &sub, void* host,
+                   const std::vector<cl_event> &wait_list) {
+  CheckError(clEnqueueReadBufferRect(queue(), buffer, CL_FALSE, kDeviceOrigin, sub.host_origin,
+                                     sub.region, sub.region[0], 0, sub.host_row_pitch, 0, host,
+                                     static_cast<cl_uint>(wait_list.size()),
+                                     wait_list.empty() ? nullptr : wait_list.data(), nullptr));
+}
+
+// Throws in the same way as the regular Netlib API functions
+void CheckStatus(const StatusCode status) {
+  if (status != StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + ToString(status));
+  }
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+NetlibPin::NetlibPin(const Context &context, const void* host_, const size_t bytes_):
+    host(host_),
+    bytes(bytes_),
+    memory(nullptr),
+    fingerprint(0),
+    valid(false) {
+  auto status = CL_SUCCESS;
+  memory = clCreateBuffer(context(), CL_MEM_READ_WRITE, bytes, nullptr, &status);
+  CLError::Check(status, "clCreateBuffer");
+}
+
+NetlibPin::~NetlibPin() {
+  BufferSizeCache::Instance().Remove(memory);
+  CheckErrorDtor(clReleaseMemObject(memory));
+}
+
+// =================================================================================================
+
+NetlibRuntime::NetlibRuntime():
+    device_(GetNetlibDevice()),
+    context_(device_),
+    queue_(context_, device_),
+    transfer_queue_(context_, device_),
+    unified_memory_(device_.HasUnifiedMemory() &&
+                    std::getenv("CLBLAST_NETLIB_NO_ZERO_COPY") == nullptr),
+    host_alignment_(device_.MemBaseAddrAlign()),
+    pool_(),
+    pool_bytes_(0),
+    pins_(),
+    bandwidth_(4.0e9) {
+}
+
+// The instance is deliberately never destroyed: releasing OpenCL objects from a static destructor
+// is unsafe since the OpenCL library might already have been unloaded at that point.
+NetlibRuntime &NetlibRuntime::Instance() {
+  static std::mutex instance_mutex;
+  static NetlibRuntime *instance = nullptr;
+  std::lock_guard<std::mutex> lock(instance_mutex);
+  if (instance == nullptr) { instance = new NetlibRuntime(); }
+  return *instance;
+}
+
+// =================================================================================================
+
+// Takes the smallest suitable buffer from the pool, or allocates a new one if there is none
+cl_mem NetlibRuntime::AcquireMemory(const size_t bytes, size_t *allocated_bytes) {
+  const auto request_bytes = (bytes == 0) ? size_t{1} : bytes;
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    auto best = pool_.end();
+    for (auto it = pool_.begin(); it != pool_.end(); ++it) {
+      if (it->bytes < request_bytes || it->bytes > request_bytes * kPoolMaxWaste) { continue; }
+      if (best == pool_.end() || it->bytes < best->bytes) { best = it; }
+    }
+    if (best != pool_.end()) {
+      const auto memory = best->memory;
+      *allocated_bytes = best->bytes;
+      pool_bytes_ -= best->bytes;
+      pool_.erase(best);
+      return memory;
+    }
+  }
+  auto status = CL_SUCCESS;
+  const auto memory = clCreateBuffer(context_(), CL_MEM_READ_WRITE, request_bytes, nullptr, &status);
+  CLError::Check(status, "clCreateBuffer");
+  *allocated_bytes = request_bytes;
+  return memory;
+}
+
+// Returns a buffer to the pool, freeing the least recently used buffers if the pool is too large.
+// Freed buffers are also removed from the buffer-size cache, since OpenCL might re-use the handle.
+void NetlibRuntime::ReleaseMemory(const cl_mem memory, const size_t bytes) {
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  pool_.push_back(PoolEntry{memory, bytes});
+  pool_bytes_ += bytes;
+  while (pool_.size() > kPoolMaxBuffers || pool_bytes_ > kPoolMaxBytes) {
+    const auto evicted = pool_.front();
+    pool_.erase(pool_.begin());
+    pool_bytes_ -= evicted.bytes;
+    BufferSizeCache::Instance().Remove(evicted.memory);
+    CheckErrorDtor(clReleaseMemObject(evicted.memory));
+  }
+}
+
+// =================================================================================================
+
+// Creates a buffer backed by the host array itself. The OpenCL run-time is allowed to copy the data
+// for alignments other than the device's base address alignment, so those arrays use staging
+// buffers instead. The 'const_cast' is safe since OpenCL only writes into it for output arrays.
+cl_mem NetlibRuntime::WrapHostMemory(const void* host, const size_t bytes) {
+  if (!unified_memory_ || host == nullptr || bytes == 0) { return nullptr; }
+  if (host_alignment_ != 0 && reinterpret_cast<uintptr_t>(host) % host_alignment_ != 0) {
+    return nullptr;
+  }
+  auto status = CL_SUCCESS;
+  const auto memory = clCreateBuffer(context_(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, bytes,
+                                     const_cast<void*>(host), &status);
+  if (status != CL_SUCCESS) { return nullptr; } // falls back to a staging buffer
+  return memory;
+}
+
+// Makes the results visible in the host array by mapping and un-mapping the buffer. In case the
+// OpenCL run-time did make a copy after all, the mapped data is copied explicitly.
+void NetlibRuntime::ReadHostMemory(const cl_mem memory, const size_t bytes, void* host) {
+  auto status = CL_SUCCESS;
+  const auto mapped = clEnqueueMapBuffer(queue_(), memory, CL_TRUE, CL_MAP_READ, 0, bytes, 0,
+                                         nullptr, nullptr, &status);
+  CLError::Check(status, "clEnqueueMapBuffer");
+  if (mapped != host) { std::memcpy(host, mapped, bytes); }
+  CheckError(clEnqueueUnmapMemObject(queue_(), memory, mapped, 0, nullptr, nullptr));
+  queue_.Finish();
+}
+
+void NetlibRuntime::ReleaseHostMemory(const cl_mem memory) {
+  BufferSizeCache::Instance().Remove(memory);
+  CheckErrorDtor(clReleaseMemObject(memory));
+}
+
+// =================================================================================================
+
+// Pins a host array, replacing any existing entry for the same host pointer
+void NetlibRuntime::Pin(const void* host, const size_t bytes) {
+  if (host == nullptr || bytes == 0) { throw BLASError(StatusCode::kInvalidValue); }
+  auto pin = std::make_shared<NetlibPin>(context_, host, bytes);
+  UploadPin(queue_, *pin);
+  std::lock_guard<std::mutex> lock(pins_mutex_);
+  for (auto &existing : pins_) {
+    if (existing->host == host) { existing = pin; return; }
+  }
+  pins_.push_back(pin);
+}
+
+void NetlibRuntime::Invalidate(const void* host) {
+  std::lock_guard<std::mutex> lock(pins_mutex_);
+  for (auto &pin : pins_) {
+    if (pin->host == host) { pin->valid = false; }
+  }
+}
+
+// The device memory is released once the last call using the pinned entry has completed
+void NetlibRuntime::Unpin(const void* host) {
+  std::lock_guard<std::mutex> lock(pins_mutex_);
+  auto it = pins_.begin();
+  while (it != pins_.end()) {
+    if ((*it)->host == host) { it = pins_.erase(it); }
+    else ++it;
+  }
+}
+
+std::shared_ptr<NetlibPin> NetlibRuntime::FindPin(const void* host, const size_t bytes) {
+  std::lock_guard<std::mutex> lock(pins_mutex_);
+  for (const auto &pin : pins_) {
+    if (pin->host != host || pin->bytes < bytes) { continue; }
+    if (!pin->valid || Fingerprint(pin->host, pin->bytes) != pin->fingerprint) {
+      UploadPin(queue_, *pin);
+    }
+    return pin;
+  }
+  return nullptr;
+}
+
+// The device copy has been read back into the host array, so they are in sync again
+void NetlibRuntime::UpdatePin(NetlibPin &pin) {
+  std::lock_guard<std::mutex> lock(pins_mutex_);
+  pin.fingerprint = Fingerprint(pin.host, pin.bytes);
+  pin.valid = true;
+}
+
+bool NetlibRuntime::IsPinned(const void* host) {
+  std::lock_guard<std::mutex> lock(pins_mutex_);
+  for (const auto &pin : pins_) {
+    if (pin->host == host) { return true; }
+  }
+  return false;
+}
+
+// =================================================================================================
+
+// The panel size is chosen such that its transfer takes about kPanelSeconds with the measured
+// bandwidth: large enough to hide the per-transfer overhead, small enough to overlap well
+size_t NetlibRuntime::PanelBytes() {
+  std::lock_guard<std::mutex> lock(bandwidth_mutex_);
+  const auto bytes = static_cast<size_t>(bandwidth_ * kPanelSeconds);
+  if (bytes < kPanelMinBytes) { return kPanelMinBytes; }
+  if (bytes > kPanelMaxBytes) { return kPanelMaxBytes; }
+  return bytes;
+}
+
+// Updates the bandwidth estimate (moving average) from the profiling information of a transfer
+void NetlibRuntime::RecordTransfer(const size_t bytes, const Event &first, const Event &last) {
+  const auto bytes_profiling = sizeof(cl_ulong);
+  auto time_start = cl_ulong{0};
+  auto time_end = cl_ulong{0};
+  CheckError(clGetEventProfilingInfo(first(), CL_PROFILING_COMMAND_START, bytes_profiling,
+                                     &time_start, nullptr));
+  CheckError(clGetEventProfilingInfo(last(), CL_PROFILING_COMMAND_END, bytes_profiling,
+                                     &time_end, nullptr));
+  if (time_end <= time_start) { return; }
+  const auto seconds = static_cast<double>(time_end - time_start) * 1.0e-9;
+  const auto bandwidth = static_cast<double>(bytes) / seconds;
+  std::lock_guard<std::mutex> lock(bandwidth_mutex_);
+  bandwidth_ = 0.75 * bandwidth_ + 0.25 * bandwidth;
+}
+
+// =================================================================================================
+
+// Pipelined GEMM: C is split in panels of columns, for which the matching columns of op(B) are
+// needed. The matrix A is copied once, the B and C panels are double-buffered: while panel 'p' is
+// computed, C of panel 'p-1' is copied back and B and C of panel 'p+1' are copied to the device.
+// The C panels are not copied to the device if beta is zero, since C is then not read.
+template <typename T>
+bool NetlibRuntime::PipelinedGemm(const Layout layout, const Transpose a_transpose,
+                                  const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k, const T alpha,
+                                  const T* a, const size_t a_ld, const T* b, const size_t b_ld,
+                                  const T beta, T* c, const size_t c_ld) {
+  if (unified_memory_ || m == 0 || n == 0 || k == 0) { return false; }
+
+  // Invalid leading dimensions are left to the regular path, which reports them with the proper
+  // status code instead of failing on a rectangular copy
+  const auto a_no_trans = (a_transpose == Transpose::kNo);
+  const auto b_no_trans = (b_transpose == Transpose::kNo);
+  const auto a_sub = GetSubMatrix<T>(layout, a_ld, 0, 0, a_no_trans ? m : k, a_no_trans ? k : m);
+  const auto b_full = GetSubMatrix<T>(layout, b_ld, 0, 0, b_no_trans ? k : n, b_no_trans ? n : k);
+  const auto c_full = GetSubMatrix<T>(layout, c_ld, 0, 0, m, n);
+  if (a_ld < a_sub.device_ld || b_ld < b_full.device_ld || c_ld < c_full.device_ld) {
+    return false;
+  }
+
+  // Decides whether or not pipelining is beneficial
+  const auto upload_c = (beta != ConstantZero<T>());
+  const auto column_bytes = (upload_c) ? (k + m) * sizeof(T) : k * sizeof(T);
+  if ((k + m) * n * sizeof(T) < kPipelineMinBytes) { return false; }
+  const auto panel_size = (PanelBytes() + column_bytes - 1) / column_bytes;
+  if (panel_size >= n) { return false; }
+  if (IsPinned(a) || IsPinned(b) || IsPinned(c)) { return false; }
+  const auto num_panels = (n + panel_size - 1) / panel_size;
+
+  // Copies the full A matrix to the device
+  auto a_buffer = Acquire<T>(m * k);
+  auto a_event = Event();
+  WriteSubMatrix(transfer_queue_, a_buffer(), a_sub, a, a_event);
+
+  // Double-buffered panels of B and C
+  auto b_buffers = std::vector<NetlibBuffer<T>>();
+  auto c_buffers = std::vector<NetlibBuffer<T>>();
+  for (auto slot = 0; slot < 2; ++slot) {
+    b_buffers.push_back(Acquire<T>(k * panel_size));
+    c_buffers.push_back(Acquire<T>(m * panel_size));
+  }
+  auto b_subs = std::vector<SubMatrix>(num_panels);
+  auto c_subs = std::vector<SubMatrix>(num_panels);
+  auto b_events = std::vector<Event>(num_panels);
+  auto c_events = std::vector<Event>(num_panels);
+  for (auto p = size_t{0}; p < num_panels; ++p) {
+    const auto col = p * panel_size;
+    const auto cols = (col + panel_size <= n) ? panel_size : n - col;
+    b_subs[p] = (b_no_trans) ? GetSubMatrix<T>(layout, b_ld, 0, col, k, cols)
+                             : GetSubMatrix<T>(layout, b_ld, col, 0, cols, k);
+    c_subs[p] = GetSubMatrix<T>(layout, c_ld, 0, col, m, cols);
+  }
+  const auto upload = [&](const size_t p) {
+    WriteSubMatrix(transfer_queue_, b_buffers[p % 2](), b_subs[p], b, b_events[p]);
+    if (upload_c) {
+      WriteSubMatrix(transfer_queue_, c_buffers[p % 2](), c_subs[p], c, c_events[p]);
+    }
+  };
+  upload(0);
+  upload(1);
+
+  // Processes the panels: the transfer queue is in-order, so C of panel 'p' is read back before
+  // the next panel is written into the same buffers
+  auto queue_plain = queue_();
+  for (auto p = size_t{0}; p < num_panels; ++p) {
+    const auto col = p * panel_size;
+    const auto cols = (col + panel_size <= n) ? panel_size : n - col;
+    const auto &last_event = (upload_c) ? c_events[p] : b_events[p];
+    last_event.WaitForCompletion();
+    RecordTransfer(column_bytes * cols, b_events[p], last_event);
+    auto compute_event = Event();
+    CheckStatus(Gemm(layout, a_transpose, b_transpose, m, cols, k, alpha,
+                     a_buffer(), 0, a_sub.device_ld,
+                     b_buffers[p % 2](), 0, b_subs[p].device_ld, beta,
+                     c_buffers[p % 2](), 0, c_subs[p].device_ld,
+                     &queue_plain, compute_event.pointer()));
+    ReadSubMatrix(transfer_queue_, c_buffers[p % 2](), c_subs[p], c, {compute_event()});
+    if (p + 2 < num_panels) { upload(p + 2); }
+  }
+  transfer_queue_.Finish();
+  return true;
+}
+
+// Pipelined GEMV: A is split in panels along the dimension of the output vector. The vectors are
+// copied once, the panels of A are double-buffered.
+template <typename T>
+bool NetlibRuntime::PipelinedGemv(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n, const T alpha,
+                                  const T* a, const size_t a_ld, const T* x, const size_t x_inc,
+                                  const T beta, T* y, const size_t y_inc) {
+  if (unified_memory_ || m == 0 || n == 0 || x_inc == 0 || y_inc == 0) { return false; }
+
+  // An invalid leading dimension is left to the regular path, which reports it with the proper
+  // status code instead of failing on a rectangular copy
+  if (a_ld < GetSubMatrix<T>(layout, a_ld, 0, 0, m, n).device_ld) { return false; }
+
+  // Decides whether or not pipelining is beneficial
+  if (m * n * sizeof(T) < kPipelineMinBytes) { return false; }
+  const auto a_no_trans = (a_transpose == Transpose::kNo);
+  const auto y_length = (a_no_trans) ? m : n;
+  const auto x_length = (a_no_trans) ? n : m;
+  const auto element_bytes = x_length * sizeof(T); // per element of the output vector
+  const auto panel_size = (PanelBytes() + element_bytes - 1) / element_bytes;
+  if (panel_size >= y_length) { return false; }
+  if (IsPinned(a) || IsPinned(x) || IsPinned(y)) { return false; }
+  const auto num_panels = (y_length + panel_size - 1) / panel_size;
+
+  // Copies the vectors to the device
+  const auto x_size = (x_length - 1) * x_inc + 1;
+  const auto y_size = (y_length - 1) * y_inc + 1;
+  auto x_buffer = Acquire<T>(x_size);
+  auto y_buffer = Acquire<T>(y_size);
+  CheckError(clEnqueueWriteBuffer(queue_(), x_buffer(), CL_FALSE, 0, x_size * sizeof(T), x, 0,
+                                  nullptr, nullptr));
+  CheckError(clEnqueueWriteBuffer(queue_(), y_buffer(), CL_FALSE, 0, y_size * sizeof(T), y, 0,
+                                  nullptr, nullptr));
+
+  // Double-buffered panels of A
+  auto a_buffers = std::vector<NetlibBuffer<T>>();
+  for (auto slot = 0; slot < 2; ++slot) { a_buffers.push_back(Acquire<T>(x_length * panel_size)); }
+  auto a_subs = std::vector<SubMatrix>(num_panels);
+  auto a_events = std::vector<Event>(num_panels);
+  auto compute_events = std::vector<Event>(num_panels);
+  for (auto p = size_t{0}; p < num_panels; ++p) {
+    const auto offset = p * panel_size;
+    const auto size = (offset + panel_size <= y_length) ? panel_size : y_length - offset;
+    a_subs[p] = (a_no_trans) ? GetSubMatrix<T>(layout, a_ld, offset, 0, size, n)
+                             : GetSubMatrix<T>(layout, a_ld, 0, offset, m, size);
+  }
+  const auto upload = [&](const size_t p) {
+    auto wait_list = std::vector<cl_event>();
+    if (p >= 2) { wait_list.push_back(compute_events[p - 2]()); } // the buffer is free again
+    WriteSubMatrix(transfer_queue_, a_buffers[p % 2](), a_subs[p], a, a_events[p], wait_list);
+  };
+  upload(0);
+  upload(1);
+
+  // Processes the panels, each computing a part of the output vector
+  auto queue_plain = queue_();
+  for (auto p = size_t{0}; p < num_panels; ++p) {
+    const auto offset = p * panel_size;
+    const auto size = (offset + panel_size <= y_length) ? panel_size : y_length - offset;
+    a_events[p].WaitForCompletion();
+    RecordTransfer(x_length * size * sizeof(T), a_events[p], a_events[p]);
+    CheckStatus(Gemv(layout, a_transpose, (a_no_trans) ? size : m, (a_no_trans) ? n : size, alpha,
+                     a_buffers[p % 2](), 0, a_subs[p].device_ld,
+                     x_buffer(), 0, x_inc, beta,
+                     y_buffer(), offset * y_inc, y_inc,
+                     &queue_plain, compute_events[p].pointer()));
+    if (p + 2 < num_panels) { upload(p + 2); }
+  }
+  y_buffer.Read(queue_, y_size, y);
+  transfer_queue_.Finish();
+  return true;
+}
+
+// Compiles the templated pipelined routines
+template bool NetlibRuntime::PipelinedGemm<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const float, const float*, const size_t,
+                                                  const float*, const size_t, const float, float*,
+                                                  const size_t);
+template bool NetlibRuntime::PipelinedGemm<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const double, const double*, const size_t,
+                                                   const double*, const size_t, const double,
+                                                   double*, const size_t);
+template bool NetlibRuntime::PipelinedGemm<float2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const float2, const float2*, const size_t,
+                                                   const float2*, const size_t, const float2,
+                                                   float2*, const size_t);
+template bool NetlibRuntime::PipelinedGemm<double2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const double2, const double2*, const size_t,
+                                                    const double2*, const size_t, const double2,
+                                                    double2*, const size_t);
+template bool NetlibRuntime::PipelinedGemv<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t, const float,
+                                                  const float*, const size_t, const float*,
+                                                  const size_t, const float, float*, const size_t);
+template bool NetlibRuntime::PipelinedGemv<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t, const double,
+                                                   const double*, const size_t, const double*,
+                                                   const size_t, const double, double*,
+                                                   const size_t);
+template bool NetlibRuntime::PipelinedGemv<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t, const float2,
+                                                   const float2*, const size_t, const float2*,
+                                                   const size_t, const float2, float2*,
+                                                   const size_t);
+template bool NetlibRuntime::PipelinedGemv<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t, const double2,
+                                                    const double2*, const size_t, const double2*,
+                                                    const size_t, const double2, double2*,
+                                                    const size_t);
+
+// =================================================================================================
+} // namespace clblast
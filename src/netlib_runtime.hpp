@@ -0,0 +1,228 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the OpenCL run-time used by the Netlib CBLAS API: a process-wide device,
+// context and queue (created lazily on the first call) and a pool of device staging buffers. This
+// avoids creating a new context for every call, which would also defeat the program cache. On top
+// of that, host arrays can be pinned to the device, such that they are only uploaded again when
+// their contents change. On devices sharing memory with the host (CPUs and integrated GPUs), host
+// arrays are used directly (zero-copy) instead of copying them to staging buffers. Finally, large
+// GEMM and GEMV calls on other devices are split in panels to overlap transfers with computation.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_NETLIB_RUNTIME_H_
+#define CLBLAST_NETLIB_RUNTIME_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T> class NetlibBuffer;
+
+// A host array pinned to the device: the device copy is valid as long as the fingerprint of the
+// host contents matches and the entry is not invalidated
+struct NetlibPin {
+  NetlibPin(const Context &context, const void* host, const size_t bytes);
+  ~NetlibPin();
+  const void* host;
+  const size_t bytes;
+  cl_mem memory;
+  uint64_t fingerprint;
+  bool valid;
+};
+
+// The process-wide OpenCL run-time for the Netlib API. The OpenCL platform and device are selected
+// through the CLBLAST_PLATFORM and CLBLAST_DEVICE environmental variables.
+class NetlibRuntime {
+ public:
+
+  // Retrieves the single instance, initializing it in a thread-safe way upon the first call
+  static NetlibRuntime &Instance();
+
+  // Accessors to the OpenCL objects
+  const Device &GetDevice() const { return device_; }
+  const Context &GetContext() const { return context_; }
+  const Queue &GetQueue() const { return queue_; }
+  const Queue &GetTransferQueue() const { return transfer_queue_; }
+
+  // Retrieves a staging buffer of at least 'size' elements from the pool. The buffer is returned
+  // to the pool when the NetlibBuffer object goes out of scope.
+  template <typename T>
+  NetlibBuffer<T> Acquire(const size_t size) { return NetlibBuffer<T>(*this, size); }
+
+  // As above, but also copies 'size' elements from the host. If the host array is pinned, its
+  // device copy is returned instead, which is only re-uploaded if the host contents changed. On
+  // unified-memory devices the host array itself is wrapped if it is suitably aligned.
+  template <typename T>
+  NetlibBuffer<T> Upload(const T* host, const size_t size) {
+    const auto pin = FindPin(host, size * sizeof(T));
+    if (pin) { return NetlibBuffer<T>(*this, pin); }
+    const auto host_memory = WrapHostMemory(host, size * sizeof(T));
+    if (host_memory) { return NetlibBuffer<T>(*this, host_memory, size); }
+    auto buffer = NetlibBuffer<T>(*this, size);
+    buffer.Write(queue_, size, host);
+    return buffer;
+  }
+
+  // Management of pinned host arrays, see the CLBlastNetlibPin/Invalidate/Unpin functions
+  void Pin(const void* host, const size_t bytes);
+  void Invalidate(const void* host);
+  void Unpin(const void* host);
+
+  // Retrieves the pinned entry for a host array of at least 'bytes' bytes (if any), making sure its
+  // device copy is up-to-date. After reading from it, the fingerprint should be updated.
+  std::shared_ptr<NetlibPin> FindPin(const void* host, const size_t bytes);
+  void UpdatePin(NetlibPin &pin);
+  bool IsPinned(const void* host);
+
+  // Pipelined versions of GEMM and GEMV for large matrices: the matrices are split in panels which
+  // are copied on the transfer queue while the previous panel is processed on the main queue. These
+  // return false without doing anything if pipelining is not applicable or not beneficial.
+  template <typename T>
+  bool PipelinedGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k, const T alpha,
+                     const T* a, const size_t a_ld, const T* b, const size_t b_ld,
+                     const T beta, T* c, const size_t c_ld);
+  template <typename T>
+  bool PipelinedGemv(const Layout layout, const Transpose a_transpose,
+                     const size_t m, const size_t n, const T alpha,
+                     const T* a, const size_t a_ld, const T* x, const size_t x_inc,
+                     const T beta, T* y, const size_t y_inc);
+
+  // Low-level access to the pool of staging buffers (sizes in bytes)
+  cl_mem AcquireMemory(const size_t bytes, size_t *allocated_bytes);
+  void ReleaseMemory(const cl_mem memory, const size_t bytes);
+
+  // Low-level zero-copy access to host memory (sizes in bytes). Wrapping returns a null-pointer if
+  // the device does not share memory with the host or if the host pointer is not aligned.
+  cl_mem WrapHostMemory(const void* host, const size_t bytes);
+  void ReadHostMemory(const cl_mem memory, const size_t bytes, void* host);
+  void ReleaseHostMemory(const cl_mem memory);
+
+ private:
+  NetlibRuntime();
+
+  // Limits of the pool of staging buffers. Released buffers beyond these limits are freed, and a
+  // pooled buffer is only re-used for requests of at least 1/kPoolMaxWaste of its size.
+  static constexpr size_t kPoolMaxBuffers = 16;
+  static constexpr size_t kPoolMaxBytes = size_t{512} * 1024 * 1024;
+  static constexpr size_t kPoolMaxWaste = 4;
+
+  // Settings of the pipelined routines: the minimum amount of data to stream before pipelining is
+  // considered and the targeted transfer time per panel (clamped to a minimum and maximum size)
+  static constexpr size_t kPipelineMinBytes = size_t{32} * 1024 * 1024;
+  static constexpr double kPanelSeconds = 0.005;
+  static constexpr size_t kPanelMinBytes = size_t{4} * 1024 * 1024;
+  static constexpr size_t kPanelMaxBytes = size_t{64} * 1024 * 1024;
+
+  // Host-to-device bandwidth, measured during the pipelined transfers
+  size_t PanelBytes();
+  void RecordTransfer(const size_t bytes, const Event &first, const Event &last);
+
+  // An unused buffer in the pool
+  struct PoolEntry {
+    cl_mem memory;
+    size_t bytes;
+  };
+
+  const Device device_;
+  const Context context_;
+  const Queue queue_;
+  const Queue transfer_queue_;
+  const bool unified_memory_;
+  const size_t host_alignment_;
+  std::vector<PoolEntry> pool_; // ordered from least to most recently released
+  size_t pool_bytes_;
+  std::mutex pool_mutex_;
+  std::vector<std::shared_ptr<NetlibPin>> pins_;
+  std::mutex pins_mutex_;
+  double bandwidth_; // in bytes per second
+  std::mutex bandwidth_mutex_;
+};
+
+// =================================================================================================
+
+// A staging buffer borrowed from the pool or the device copy of a pinned host array: provides the
+// same Read/Write interface as Buffer<T>
+template <typename T>
+class NetlibBuffer {
+ public:
+  NetlibBuffer(NetlibRuntime &runtime, const size_t size):
+      runtime_(&runtime),
+      memory_(runtime.AcquireMemory(size * sizeof(T), &bytes_)),
+      buffer_(memory_),
+      pin_(),
+      host_memory_(false) {
+  }
+  NetlibBuffer(NetlibRuntime &runtime, const std::shared_ptr<NetlibPin> &pin):
+      runtime_(&runtime),
+      memory_(pin->memory),
+      bytes_(pin->bytes),
+      buffer_(memory_),
+      pin_(pin),
+      host_memory_(false) {
+  }
+  NetlibBuffer(NetlibRuntime &runtime, const cl_mem host_memory, const size_t size):
+      runtime_(&runtime),
+      memory_(host_memory),
+      bytes_(size * sizeof(T)),
+      buffer_(memory_),
+      pin_(),
+      host_memory_(true) {
+  }
+  NetlibBuffer(NetlibBuffer &&other):
+      runtime_(other.runtime_),
+      memory_(other.memory_),
+      bytes_(other.bytes_),
+      buffer_(other.buffer_),
+      pin_(std::move(other.pin_)),
+      host_memory_(other.host_memory_) {
+    other.runtime_ = nullptr;
+  }
+  ~NetlibBuffer() {
+    if (!runtime_ || pin_) { return; }
+    if (host_memory_) { runtime_->ReleaseHostMemory(memory_); }
+    else { runtime_->ReleaseMemory(memory_, bytes_); }
+  }
+  NetlibBuffer(const NetlibBuffer &) = delete;
+  NetlibBuffer &operator=(const NetlibBuffer &) = delete;
+
+  // Copies between host and device, see the corresponding Buffer<T> methods
+  void Write(const Queue &queue, const size_t size, const T* host) {
+    buffer_.Write(queue, size, host);
+  }
+  void Read(const Queue &queue, const size_t size, T* host) const {
+    if (host_memory_) { runtime_->ReadHostMemory(memory_, size * sizeof(T), host); return; }
+    buffer_.Read(queue, size, host);
+    if (pin_) { runtime_->UpdatePin(*pin_); }
+  }
+
+  // Accessor to the underlying OpenCL buffer
+  const cl_mem& operator()() const { return buffer_(); }
+ private:
+  NetlibRuntime *runtime_;
+  cl_mem memory_;
+  size_t bytes_;
+  Buffer<T> buffer_; // not owned: memory is managed by the pool or by the pinned entry
+  std::shared_ptr<NetlibPin> pin_;
+  bool host_memory_; // whether or not this is a zero-copy wrapper around host memory
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_NETLIB_RUNTIME_H_
+#endif
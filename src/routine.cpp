@@ -25,10 +25,14 @@ namespace clblast {
 const std::vector<std::string> Routine::routines_axpy = {"AXPY", "COPY", "SCAL", "SWAP"};
 const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "MAX", "MIN", "NRM2", "SUM"};
 const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERU", "HER", "HER2", "HPR", "HPR2", "SPR", "SPR2", "SYR", "SYR2"};
-const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV"};
-const std::vector<std::string> Routine::routines_gemm = {"GEMM", "HEMM", "SYMM", "TRMM"};
-const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
-const std::vector<std::string> Routine::routines_trsm = {"TRSM"};
+const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV", "GEMVBATCHED", "GEMVSTRIDEDBATCHED", "TRSVBATCHED", "TRSVSTRIDEDBATCHED", "TRSMBATCHED", "TRSMSTRIDEDBATCHED"};
+const std::vector<std::string> Routine::routines_gemm = {"GEMM", "GEMMEPILOGUE", "HEMM", "SYMM", "TRMM"};
+const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "GEMM3M", "GEMMEPILOGUE", "GETRF", "HEMM", "HER2K", "HERK", "POTRF", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
+const std::vector<std::string> Routine::routines_trsm = {"TRSM", "TRSMBATCHED", "TRSMSTRIDEDBATCHED"};
+const std::vector<std::string> Routine::routines_trmm = {"TRMM"};
+const std::vector<std::string> Routine::routines_gemm_batched = {"GEMMBATCHED", "GEMMSTRIDEDBATCHED", "GEMMGROUPEDBATCHED"};
+const std::vector<std::string> Routine::routines_gemm_mixed = {"GEMMMIXED", "GEMMMIXEDHALF"};
+const std::vector<std::string> Routine::routines_gemm_int8 = {"GEMMINT8", "GEMMINT8FLOAT", "GEMMINT8INT32"};
 const std::unordered_map<std::string, const std::vector<std::string>> Routine::routines_by_kernel = {
   {"Xaxpy", routines_axpy},
   {"Xdot", routines_dot},
@@ -45,6 +49,16 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
   {"XgemmDirect", routines_gemm},
   {"KernelSelection", routines_gemm},
   {"Invert", routines_trsm},
+  {"XgemmBatched", routines_gemm_batched},
+  {"XgemmDirectBatched", routines_gemm_batched},
+  {"KernelSelectionBatched", routines_gemm_batched},
+  {"KernelSelectionSmallBatched", routines_gemm_batched},
+  {"KernelSelectionSplitK", routines_gemm},
+  {"KernelSelectionStreamK", routines_gemm},
+  {"KernelSelectionTrmm", routines_trmm},
+  {"KernelSelectionStrassen", routines_gemm},
+  {"XgemmMixed", routines_gemm_mixed},
+  {"XgemmInt8", routines_gemm_int8},
 };
 // =================================================================================================
 
@@ -23,6 +23,7 @@
 #include "utilities/utilities.hpp"
 #include "cache.hpp"
 #include "utilities/buffer_test.hpp"
+#include "utilities/accuracy.hpp"
 #include "database/database.hpp"
 #include "routines/common.hpp"
 
@@ -51,6 +52,10 @@ class Routine {
   static const std::vector<std::string> routines_gemm;
   static const std::vector<std::string> routines_gemm_syrk;
   static const std::vector<std::string> routines_trsm;
+  static const std::vector<std::string> routines_trmm;
+  static const std::vector<std::string> routines_gemm_batched;
+  static const std::vector<std::string> routines_gemm_mixed;
+  static const std::vector<std::string> routines_gemm_int8;
   static const std::unordered_map<std::string, const std::vector<std::string>> routines_by_kernel;
 
  private:
@@ -12,6 +12,7 @@
 // =================================================================================================
 
 #include <vector>
+#include <algorithm>
 #include <chrono>
 
 #include "routines/common.hpp"
@@ -72,5 +73,30 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
   #endif
 }
 
+// Returns the size of the smallest specialised tiny-matrix batched GEMM kernel which fits
+size_t SmallBatchedGemmSize(const size_t m, const size_t n, const size_t k, const size_t max_size) {
+  const auto matrix_size = std::max(std::max(m, n), k);
+  if (matrix_size > max_size) { return 0; }
+  for (const auto size: {size_t{4}, size_t{8}, size_t{16}, size_t{32}}) {
+    if (matrix_size <= size) { return size; }
+  }
+  return 0;
+}
+
+// Returns the number of tiles holding elements of the triangle, counted per column of tiles in the
+// same way as the 'GetTriangleTile' function of the triangular GEMM kernels
+size_t TriangleTileCount(const size_t n, const size_t tile_m, const size_t tile_n,
+                         const bool is_upper) {
+  const auto num_tiles_m = n / tile_m;
+  auto num_tiles = size_t{0};
+  for (auto tn = size_t{0}; tn < n / tile_n; ++tn) {
+    const auto first = (is_upper) ? 0 : (tn * tile_n) / tile_m;
+    const auto last = (is_upper) ? std::min(num_tiles_m, ((tn + 1) * tile_n - 1) / tile_m + 1)
+                                 : num_tiles_m;
+    num_tiles += last - first;
+  }
+  return num_tiles;
+}
+
 // =================================================================================================
 } // namespace clblast
@@ -31,6 +31,16 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
                std::vector<size_t> global, const std::vector<size_t> &local,
                EventPointer event, const std::vector<Event> &waitForEvents = {});
 
+// Returns the size of the smallest specialised tiny-matrix batched GEMM kernel which can compute a
+// GEMM of the given dimensions, or zero if the matrices are too large for these kernels or larger
+// than the given maximum size (zero disables these kernels)
+size_t SmallBatchedGemmSize(const size_t m, const size_t n, const size_t k, const size_t max_size);
+
+// Returns the number of tiles of an n-by-n matrix (with n a multiple of both tile dimensions) which
+// hold elements of its upper or lower triangle, as launched by the triangular GEMM kernels
+size_t TriangleTileCount(const size_t n, const size_t tile_m, const size_t tile_n,
+                         const bool is_upper);
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
@@ -34,6 +34,15 @@ template <typename T>
 void Xamax<T>::DoAmax(const size_t n,
                       const Buffer<unsigned int> &imax_buffer, const size_t imax_offset,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+  DoAmax(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, event_, std::vector<Event>());
+}
+
+// As above, but with a given output event and a list of events to wait for before starting
+template <typename T>
+void Xamax<T>::DoAmax(const size_t n,
+                      const Buffer<unsigned int> &imax_buffer, const size_t imax_offset,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -66,7 +75,7 @@ void Xamax<T>::DoAmax(const size_t n,
   auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
   auto local1 = std::vector<size_t>{db_["WGS1"]};
   auto kernelEvent = Event();
-  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer(), waitForEvents);
   eventWaitList.push_back(kernelEvent);
 
   // Sets the arguments for the epilogue kernel
@@ -78,7 +87,7 @@ void Xamax<T>::DoAmax(const size_t n,
   // Launches the epilogue kernel
   auto global2 = std::vector<size_t>{db_["WGS2"]};
   auto local2 = std::vector<size_t>{db_["WGS2"]};
-  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+  RunKernel(kernel2, queue_, device_, global2, local2, event, eventWaitList);
 }
 
 // =================================================================================================
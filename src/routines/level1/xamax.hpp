@@ -31,6 +31,11 @@ class Xamax: public Routine {
   void DoAmax(const size_t n,
               const Buffer<unsigned int> &imax_buffer, const size_t imax_offset,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+  // As above, but with a given output event and a list of events to wait for before starting
+  void DoAmax(const size_t n,
+              const Buffer<unsigned int> &imax_buffer, const size_t imax_offset,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+              EventPointer event, const std::vector<Event> &waitForEvents);
 };
 
 // =================================================================================================
@@ -40,6 +40,21 @@ void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
                       const T beta,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+  DoGemv(layout, a_transpose, m, n, alpha,
+         a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta,
+         y_buffer, y_offset, y_inc, event_, std::vector<Event>());
+}
+
+// As above, but with a given output event and a list of events to wait for before starting
+template <typename T>
+void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const T beta,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Performs the matrix-vector multiplication
   MatVec(layout, a_transpose,
@@ -48,7 +63,8 @@ void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
          x_buffer, x_offset, x_inc, beta,
          y_buffer, y_offset, y_inc,
          true, true,
-         0, false, 0, 0); // N/A for this routine
+         0, false, 0, 0, // N/A for this routine
+         event, waitForEvents);
 }
 
 // =================================================================================================
@@ -65,6 +81,25 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
                       bool fast_kernel, bool fast_kernel_rot,
                       const size_t parameter, const bool packed,
                       const size_t kl, const size_t ku) {
+  MatVec(layout, a_transpose, m, n, alpha,
+         a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta,
+         y_buffer, y_offset, y_inc, fast_kernel, fast_kernel_rot,
+         parameter, packed, kl, ku, event_, std::vector<Event>());
+}
+
+// As above, but with a given output event and a list of events to wait for before starting
+template <typename T>
+void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const T beta,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                      bool fast_kernel, bool fast_kernel_rot,
+                      const size_t parameter, const bool packed,
+                      const size_t kl, const size_t ku,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -148,7 +183,7 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   // Launches the kernel
   auto global = std::vector<size_t>{global_size};
   auto local = std::vector<size_t>{local_size};
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
 }
 
 // =================================================================================================
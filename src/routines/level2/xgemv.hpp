@@ -35,6 +35,15 @@ class Xgemv: public Routine {
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
               const T beta,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+  // As above, but with a given output event and a list of events to wait for before starting
+  void DoGemv(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+              const T beta,
+              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+              EventPointer event, const std::vector<Event> &waitForEvents);
 
   // Generic version used also for other matrix-vector multiplications
   void MatVec(const Layout layout, const Transpose a_transpose,
@@ -47,6 +56,17 @@ class Xgemv: public Routine {
               bool fast_kernel, bool fast_kernel_rot,
               const size_t parameter, const bool packed,
               const size_t kl, const size_t ku);
+  void MatVec(const Layout layout, const Transpose a_transpose,
+              const size_t m, const size_t n,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+              const T beta,
+              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+              bool fast_kernel, bool fast_kernel_rot,
+              const size_t parameter, const bool packed,
+              const size_t kl, const size_t ku,
+              EventPointer event, const std::vector<Event> &waitForEvents);
 };
 
 // =================================================================================================
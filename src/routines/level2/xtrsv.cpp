@@ -33,7 +33,8 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
                             const size_t n,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
-                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
 
   if (n > db_["TRSV_BLOCK_SIZE"]) { throw BLASError(StatusCode::kUnexpectedError); };
 
@@ -69,9 +70,50 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
   // Launches the kernel
   const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
   const auto global = std::vector<size_t>{1};
-  auto event = Event();
-  RunKernel(kernel, queue_, device_, global, local, event.pointer());
-  event.WaitForCompletion();
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xtrsv<T>::SingleKernelSubstitution(const Layout layout, const Triangle triangle,
+                                        const Transpose a_transpose, const Diagonal diagonal,
+                                        const size_t n,
+                                        const Buffer<T> &a_buffer, const size_t a_offset,
+                                        const size_t a_ld,
+                                        const Buffer<T> &x_buffer, const size_t x_offset,
+                                        const size_t x_inc) {
+
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel
+  const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+  const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
+
+  // The data is either in the upper or lower triangle
+  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
+                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "trsv_single");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, a_buffer());
+  kernel.SetArgument(2, static_cast<int>(a_offset));
+  kernel.SetArgument(3, static_cast<int>(a_ld));
+  kernel.SetArgument(4, x_buffer());
+  kernel.SetArgument(5, static_cast<int>(x_offset));
+  kernel.SetArgument(6, static_cast<int>(x_inc));
+  kernel.SetArgument(7, static_cast<int>(is_upper));
+  kernel.SetArgument(8, static_cast<int>(is_transposed));
+  kernel.SetArgument(9, static_cast<int>(is_unit_diagonal));
+  kernel.SetArgument(10, static_cast<int>(do_conjugate));
+
+  // Launches the kernel: a single work-group processes the whole matrix
+  const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
+  const auto global = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
 }
 
 // =================================================================================================
@@ -91,20 +133,31 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
   TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, b_buffer, b_offset, b_inc);
 
+  // Smaller systems are solved in-place by a single kernel. This avoids the temporary copy and the
+  // two dependent kernel launches per block of the block-algorithm below.
+  if (n <= db_["TRSV_SINGLE_MAX"]) {
+    SingleKernelSubstitution(layout, triangle, a_transpose, diagonal, n,
+                             a_buffer, a_offset, a_ld, b_buffer, b_offset, b_inc);
+    return;
+  }
+
   // Creates a copy of B to avoid overwriting input while computing output
   // TODO: Make x with 0 offset and unit increment by creating custom copy-to and copy-from kernels
   const auto x_offset = b_offset;
   const auto x_inc = b_inc;
   const auto x_size = n*x_inc + x_offset;
   auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
+  auto copy_event = Event();
+  b_buffer.CopyToAsync(queue_, x_size, x_buffer, copy_event.pointer(), std::vector<Event>());
 
   // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
+  auto eventWaitList = std::vector<Event>{copy_event};
   auto fill_vector_event = Event();
   FillVector(queue_, device_, program_, db_, fill_vector_event.pointer(), eventWaitList,
              n, x_inc, x_offset, x_buffer, ConstantZero<T>());
-  fill_vector_event.WaitForCompletion();
+
+  // From here on all kernels are chained through events without synchronising with the host
+  eventWaitList = std::vector<Event>{fill_vector_event};
 
   // Derives properties based on the arguments
   const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
@@ -131,21 +184,27 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
     if (i > 0) {
       const auto gemv_m = (a_transpose == Transpose::kNo) ? block_size : i;
       const auto gemv_n = (a_transpose == Transpose::kNo) ? i : block_size;
+      auto gemv_event = Event();
       DoGemv(layout, a_transpose, gemv_m, gemv_n, ConstantOne<T>(),
              a_buffer, a_offset + extra_offset_a, a_ld,
              x_buffer, x_offset + extra_offset_x, x_inc, ConstantOne<T>(),
-             x_buffer, x_offset + extra_offset_b, x_inc );
+             x_buffer, x_offset + extra_offset_b, x_inc,
+             gemv_event.pointer(), eventWaitList);
+      eventWaitList = std::vector<Event>{gemv_event};
     }
 
     // Runs the triangular substitution for the block size
+    auto substitution_event = Event();
     Substitution(layout, triangle, a_transpose, diagonal, block_size,
                  a_buffer, a_offset + col + col*a_ld, a_ld,
                  b_buffer, b_offset + col*b_inc, b_inc,
-                 x_buffer, x_offset + col*x_inc, x_inc);
+                 x_buffer, x_offset + col*x_inc, x_inc,
+                 substitution_event.pointer(), eventWaitList);
+    eventWaitList = std::vector<Event>{substitution_event};
   }
 
   // Retrieves the results
-  x_buffer.CopyTo(queue_, x_size, b_buffer);
+  x_buffer.CopyToAsync(queue_, x_size, b_buffer, event_, eventWaitList);
 }
 
 // =================================================================================================
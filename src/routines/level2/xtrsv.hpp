@@ -9,7 +9,8 @@
 //
 // This file implements the Xtrsv routine. It uses a block-algorithm and performs small triangular
 // forward and backward substitutions on the diagonal parts of the matrix in combination with larger
-// GEMV computation on the remainder of the matrix.
+// GEMV computation on the remainder of the matrix. Smaller systems are instead solved by a single
+// kernel, avoiding the many dependent kernel launches of the block-algorithm.
 //
 // =================================================================================================
 
@@ -32,6 +33,7 @@ class Xtrsv: public Xgemv<T> {
   using Xgemv<T>::device_;
   using Xgemv<T>::db_;
   using Xgemv<T>::program_;
+  using Xgemv<T>::event_;
   using Xgemv<T>::DoGemv;
 
   // Constructor
@@ -50,7 +52,17 @@ class Xtrsv: public Xgemv<T> {
                     const size_t n,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
-                    const Buffer<T> &x_buffer, const size_t offset_x, const size_t x_inc);
+                    const Buffer<T> &x_buffer, const size_t offset_x, const size_t x_inc,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Solves the entire system in-place with a single kernel launch, used for smaller sizes
+  void SingleKernelSubstitution(const Layout layout, const Triangle triangle,
+                                const Transpose a_transpose, const Diagonal diagonal,
+                                const size_t n,
+                                const Buffer<T> &a_buffer, const size_t a_offset,
+                                const size_t a_ld,
+                                const Buffer<T> &x_buffer, const size_t x_offset,
+                                const size_t x_inc);
 };
 
 // =================================================================================================
@@ -13,6 +13,8 @@
 
 #include "routines/level3/xgemm.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -23,7 +25,8 @@ namespace clblast {
 template <typename T>
 Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name,
-            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","KernelSelection"},
+            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","KernelSelection",
+             "KernelSelectionSplitK","KernelSelectionStreamK","KernelSelectionStrassen"},
             PrecisionValue<T>(), {}, {
     #include "../../kernels/level3/level3.opencl"
     #include "../../kernels/level3/copy_fast.opencl"
@@ -32,16 +35,21 @@ Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
     #include "../../kernels/level3/transpose_pad.opencl"
     #include "../../kernels/level3/convert_symmetric.opencl"
     #include "../../kernels/level3/convert_triangular.opencl"
-    #include "../../kernels/level3/convert_hermitian.opencl"
     , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_epilogue.opencl"
     #include "../../kernels/level3/xgemm_direct_part1.opencl"
     #include "../../kernels/level3/xgemm_direct_part2.opencl"
     #include "../../kernels/level3/xgemm_direct_part3.opencl"
+    #include "../../kernels/level3/xgemm_direct_splitk.opencl"
     , // separated in multiple parts to prevent C1091 in MSVC 2013
     #include "../../kernels/level3/xgemm_part1.opencl"
     #include "../../kernels/level3/xgemm_part2.opencl"
     #include "../../kernels/level3/xgemm_part3.opencl"
-    }) {
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_streamk.opencl"
+    #include "../../kernels/level3/xgemm_strassen.opencl"
+    }),
+    strassen_active_(false) {
 }
 
 template <typename T>
@@ -56,16 +64,21 @@ Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::vector<std::string>
     #include "../../kernels/level3/transpose_pad.opencl"
     #include "../../kernels/level3/convert_symmetric.opencl"
     #include "../../kernels/level3/convert_triangular.opencl"
-    #include "../../kernels/level3/convert_hermitian.opencl"
     , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_epilogue.opencl"
     #include "../../kernels/level3/xgemm_direct_part1.opencl"
     #include "../../kernels/level3/xgemm_direct_part2.opencl"
     #include "../../kernels/level3/xgemm_direct_part3.opencl"
+    #include "../../kernels/level3/xgemm_direct_splitk.opencl"
     , // separated in multiple parts to prevent C1091 in MSVC 2013
     #include "../../kernels/level3/xgemm_part1.opencl"
     #include "../../kernels/level3/xgemm_part2.opencl"
     #include "../../kernels/level3/xgemm_part3.opencl"
-    }) {
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_streamk.opencl"
+    #include "../../kernels/level3/xgemm_strassen.opencl"
+    }),
+    strassen_active_(false) {
 }
 
 // =================================================================================================
@@ -80,6 +93,22 @@ void Xgemm<T>::DoGemm(const Layout layout,
                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
                       const T beta,
                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  DoGemm(layout, a_transpose, b_transpose, m, n, k,
+         alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+         beta, c_buffer, c_offset, c_ld, event_, std::vector<Event>());
+}
+
+// As above, but with a given output event and a list of events to wait for before starting
+template <typename T>
+void Xgemm<T>::DoGemm(const Layout layout,
+                      const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -125,14 +154,36 @@ void Xgemm<T>::DoGemm(const Layout layout,
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
 
+  // For very large matrices in reduced-accuracy mode, runs the Strassen-Winograd version instead.
+  // This calls back into this function for its sub-products, which then run one of the versions
+  // below.
+  const auto strassen_levels = GemmStrassenLevels(m, n, k);
+  if (strassen_levels > 0) {
+    GemmStrassen(layout, a_transpose, b_transpose, m, n, k, alpha,
+                 a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                 c_buffer, c_offset, c_ld,
+                 a_rotated, b_rotated, c_rotated, strassen_levels, event, waitForEvents);
+    return;
+  }
+
   // Selects which version of GEMM to run 
   const auto m_n_k = static_cast<unsigned long>(m) * static_cast<unsigned long>(n) * static_cast<unsigned long>(k);
   const auto do_gemm_direct = (m_n_k < static_cast<unsigned long>(db_["XGEMM_MIN_INDIRECT_SIZE"]));
-  if (do_gemm_direct) { // for small sizes (single kernel)
+  const auto has_mirror = (MirrorA() != kMirrorNone || MirrorB() != kMirrorNone);
+  const auto num_splits = (HasEpilogue() || has_mirror) ? 1 : GemmSplitKCount(m, n, k);
+  if (num_splits > 1) { // for small m and n but large k (too few tiles to fill the device)
+    GemmSplitK(m, n, k, alpha,
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+               c_buffer, c_offset, c_ld,
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               num_splits, event, waitForEvents);
+  }
+  else if (do_gemm_direct) { // for small sizes (single kernel)
     GemmDirect(m, n, k, alpha,
                a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
                c_buffer, c_offset, c_ld,
-               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               event, waitForEvents);
   }
   else { // for larger sizes (pre/post-processing plus a very fast kernel)
     GemmIndirect(m, n, k, alpha,
@@ -141,7 +192,8 @@ void Xgemm<T>::DoGemm(const Layout layout,
                  a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                  a_one, a_two, a_want_rotated,
                  b_one, b_two, b_want_rotated,
-                 c_one, c_two, c_want_rotated);
+                 c_one, c_two, c_want_rotated,
+                 event, waitForEvents);
   }
 }
 
@@ -208,7 +260,8 @@ void Xgemm<T>::DoGemm(const Layout layout,
     GemmDirect(m, n, k, alpha,
                a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
                c_buffer, c_offset, c_ld,
-               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               event_, std::vector<Event>());
   }
   else { // for larger sizes (pre/post-processing plus a very fast kernel)
     GemmIndirect(m, n, k, alpha,
@@ -217,7 +270,8 @@ void Xgemm<T>::DoGemm(const Layout layout,
                  a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                  a_one, a_two, a_want_rotated,
                  b_one, b_two, b_want_rotated,
-                 c_one, c_two, c_want_rotated);
+                 c_one, c_two, c_want_rotated,
+                 event_, std::vector<Event>());
   }
 }
 
@@ -238,7 +292,8 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
                             const bool a_conjugate, const bool b_conjugate,
                             const size_t a_one, const size_t a_two, const bool a_want_rotated,
                             const size_t b_one, const size_t b_two, const bool b_want_rotated,
-                            const size_t c_one, const size_t c_two, const bool c_want_rotated) {
+                            const size_t c_one, const size_t c_two, const bool c_want_rotated,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
   // Calculates the ceiled versions of m, n, and k
   const auto m_ceiled = Ceil(m, db_["MWG"]);
   const auto n_ceiled = Ceil(n, db_["NWG"]);
@@ -255,9 +310,9 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
 
   // Determines whether or not temporary matrices are needed
   auto a_no_temp = a_one == a_one_i && a_two == a_two_i && a_ld == a_one && a_offset == 0 &&
-                   a_do_transpose == false && a_conjugate == false;
+                   a_do_transpose == false && a_conjugate == false && MirrorA() == kMirrorNone;
   auto b_no_temp = b_one == b_one_i && b_two == b_two_i && b_ld == b_one && b_offset == 0 &&
-                   b_do_transpose == false && b_conjugate == false;
+                   b_do_transpose == false && b_conjugate == false && MirrorB() == kMirrorNone;
   auto c_no_temp = c_one == c_one_i && c_two == c_two_i && c_ld == c_one && c_offset == 0 &&
                    c_do_transpose == false;
 
@@ -266,38 +321,53 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   const auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, b_one_i*b_two_i);
   const auto c_temp = (c_no_temp) ? c_buffer : Buffer<T>(context_, c_one_i*c_two_i);
 
-  // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  // Events of all kernels (including pre/post processing kernels). The main kernel also waits for
+  // the given events directly, in case none of the pre-processing kernels is needed.
+  auto eventWaitList = waitForEvents;
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
-  // case nothing has to be done, these kernels can be skipped.
+  // case nothing has to be done, these kernels can be skipped. A matrix with only one triangle
+  // stored is mirrored into a full matrix instead.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
-                           a_one, a_two, a_ld, a_offset, a_buffer,
-                           a_one_i, a_two_i, a_one_i, 0, a_temp,
-                           ConstantOne<T>(), program_,
-                           true, a_do_transpose, a_conjugate);
+    if (MirrorA() != kMirrorNone) {
+      MirrorPadMatrix(eventProcessA.pointer(), waitForEvents, MirrorA(),
+                      a_one, a_ld, a_offset, a_buffer, a_one_i, a_two_i, a_temp,
+                      a_do_transpose, a_conjugate);
+    }
+    else {
+      PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), waitForEvents,
+                             a_one, a_two, a_ld, a_offset, a_buffer,
+                             a_one_i, a_two_i, a_one_i, 0, a_temp,
+                             ConstantOne<T>(), program_,
+                             true, a_do_transpose, a_conjugate);
+    }
     eventWaitList.push_back(eventProcessA);
   }
 
   // As above, but now for matrix B
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
-                           b_one, b_two, b_ld, b_offset, b_buffer,
-                           b_one_i, b_two_i, b_one_i, 0, b_temp,
-                           ConstantOne<T>(), program_,
-                           true, b_do_transpose, b_conjugate);
+    if (MirrorB() != kMirrorNone) {
+      MirrorPadMatrix(eventProcessB.pointer(), waitForEvents, MirrorB(),
+                      b_one, b_ld, b_offset, b_buffer, b_one_i, b_two_i, b_temp,
+                      b_do_transpose, b_conjugate);
+    }
+    else {
+      PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), waitForEvents,
+                             b_one, b_two, b_ld, b_offset, b_buffer,
+                             b_one_i, b_two_i, b_one_i, 0, b_temp,
+                             ConstantOne<T>(), program_,
+                             true, b_do_transpose, b_conjugate);
+    }
     eventWaitList.push_back(eventProcessB);
   }
 
   // As above, but now for matrix C. This is only necessary if C is used both as input and output.
   if (!c_no_temp && beta != static_cast<T>(0)) {
     auto eventProcessC = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), waitForEvents,
                            c_one, c_two, c_ld, c_offset, c_buffer,
                            c_one_i, c_two_i, c_one_i, 0, c_temp,
                            ConstantOne<T>(), program_,
@@ -317,6 +387,7 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   kernel.SetArgument(5, a_temp());
   kernel.SetArgument(6, b_temp());
   kernel.SetArgument(7, c_temp());
+  SetEpilogueArguments(kernel, 8);
 
   // Computes the global and local thread sizes
   const auto global = std::vector<size_t>{
@@ -325,15 +396,30 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   };
   const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
 
+  // Determines whether to use the stream-K version of the kernel instead: this is the case if the
+  // tiles fill only a few waves of work-groups over the compute units and the last is incomplete.
+  // The stream-K kernels don't support an epilogue.
+  const auto num_tiles = (c_one_i / db_["MWG"]) * (c_two_i / db_["NWG"]);
+  const auto num_units = device_.ComputeUnits();
+  const auto use_streamk = CeilDiv(num_tiles, num_units) <= db_["XGEMM_STREAMK_MAX_WAVES"] &&
+                           (num_tiles % num_units != 0) && (k_ceiled > db_["KWG"]) &&
+                           !HasEpilogue();
+
   // Launches the kernel
   auto eventKernel = Event();
-  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
-  RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
+  auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event;
+  if (use_streamk) {
+    GemmStreamK(m_ceiled, n_ceiled, k_ceiled, alpha, beta, a_temp, b_temp, c_temp,
+                eventPointer, eventWaitList);
+  }
+  else {
+    RunKernel(kernel, queue_, device_, global, local, eventPointer, eventWaitList);
+  }
 
   // Runs the post-processing kernel if needed
   if (!c_no_temp) {
     eventWaitList.push_back(eventKernel);
-    PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
+    PadCopyTransposeMatrix(queue_, device_, db_, event, eventWaitList,
                            c_one_i, c_two_i, c_one_i, 0, c_temp,
                            c_one, c_two, c_ld, c_offset, c_buffer,
                            ConstantOne<T>(), program_,
@@ -353,7 +439,8 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
                           const T beta,
                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                           const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                          const bool a_conjugate, const bool b_conjugate) {
+                          const bool a_conjugate, const bool b_conjugate,
+                          EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN") :
@@ -378,6 +465,13 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
   kernel.SetArgument(14, static_cast<int>(c_do_transpose));
   kernel.SetArgument(15, static_cast<int>(a_conjugate));
   kernel.SetArgument(16, static_cast<int>(b_conjugate));
+  if (MirrorA() != kMirrorNone || MirrorB() != kMirrorNone) {
+    kernel.SetArgument(17, MirrorA());
+    kernel.SetArgument(18, MirrorB());
+  }
+  else {
+    SetEpilogueArguments(kernel, 17);
+  }
 
   // Computes the global and local thread sizes
   const auto m_ceiled = Ceil(m, db_["WGD"]);
@@ -389,8 +483,441 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
   const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
 
   // Launches the kernel
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// The stream-K version of the in-direct GEMM kernel. This launches one persistent work-group per
+// compute unit, each processing an equal share of all iterations over the tiles and their parts of
+// the k-dimension. The tiles which are split over multiple work-groups are completed by the fix-up
+// kernel. The matrices are the (pre-processed) matrices of the regular in-direct kernel.
+template <typename T>
+void Xgemm<T>::GemmStreamK(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled,
+                           const T alpha, const T beta,
+                           const Buffer<T> &a_temp, const Buffer<T> &b_temp, const Buffer<T> &c_temp,
+                           EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Divides the iterations over the work-groups and creates the buffer for the partial tiles
+  const auto num_groups = device_.ComputeUnits();
+  const auto num_tiles = (m_ceiled / db_["MWG"]) * (n_ceiled / db_["NWG"]);
+  const auto num_iters = num_tiles * (k_ceiled / db_["KWG"]);
+  const auto iters_per_group = CeilDiv(num_iters, num_groups);
+  const auto partials = Buffer<T>(context_, 2 * num_groups * db_["MWG"] * db_["NWG"]);
+
+  // Retrieves the stream-K kernel from the compiled binary and sets its arguments
+  auto kernel = Kernel(program_, "XgemmStreamK");
+  kernel.SetArgument(0, static_cast<int>(m_ceiled));
+  kernel.SetArgument(1, static_cast<int>(n_ceiled));
+  kernel.SetArgument(2, static_cast<int>(k_ceiled));
+  kernel.SetArgument(3, static_cast<int>(iters_per_group));
+  kernel.SetArgument(4, GetRealArg(alpha));
+  kernel.SetArgument(5, GetRealArg(beta));
+  kernel.SetArgument(6, a_temp());
+  kernel.SetArgument(7, b_temp());
+  kernel.SetArgument(8, c_temp());
+  kernel.SetArgument(9, partials());
+
+  // Launches the kernel with one work-group per compute unit
+  const auto global = std::vector<size_t>{num_groups * db_["MDIMC"], db_["NDIMC"]};
+  const auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+  auto eventKernel = Event();
+  RunKernel(kernel, queue_, device_, global, local, eventKernel.pointer(), waitForEvents);
+
+  // Retrieves the fix-up kernel and sets its arguments
+  auto fixup_kernel = Kernel(program_, "XgemmStreamKFixup");
+  fixup_kernel.SetArgument(0, static_cast<int>(m_ceiled));
+  fixup_kernel.SetArgument(1, static_cast<int>(n_ceiled));
+  fixup_kernel.SetArgument(2, static_cast<int>(k_ceiled));
+  fixup_kernel.SetArgument(3, static_cast<int>(iters_per_group));
+  fixup_kernel.SetArgument(4, GetRealArg(beta));
+  fixup_kernel.SetArgument(5, partials());
+  fixup_kernel.SetArgument(6, c_temp());
+
+  // Launches the fix-up kernel after the stream-K kernel has completed
+  const auto fixup_global = std::vector<size_t>{Ceil(m_ceiled, 8), Ceil(n_ceiled, 8)};
+  const auto fixup_local = std::vector<size_t>{8, 8};
+  auto fixupWaitList = std::vector<Event>{eventKernel};
+  RunKernel(fixup_kernel, queue_, device_, fixup_global, fixup_local, event, fixupWaitList);
+}
+
+// =================================================================================================
+
+// Determines the number of parts for the split-K version of GEMM. Splitting is only done if the
+// tiles of the direct kernel can't occupy all compute units and if each part is large enough for
+// the cost of the reduction to be small. Each part is a multiple of the tile size in k-dimension.
+// The minimum size of a part and the targeted number of work-groups per compute unit are taken from
+// the database.
+template <typename T>
+size_t Xgemm<T>::GemmSplitKCount(const size_t m, const size_t n, const size_t k) const {
+  const auto min_size = static_cast<size_t>(db_["XGEMM_SPLITK_MIN_SIZE"]);
+  const auto groups_per_unit = static_cast<size_t>(db_["XGEMM_SPLITK_GROUPS_PER_UNIT"]);
+  if (min_size == 0 || groups_per_unit == 0) { return 1; }
+  const auto num_tiles = CeilDiv(m, db_["WGD"]) * CeilDiv(n, db_["WGD"]);
+  const auto target_groups = device_.ComputeUnits() * groups_per_unit;
+  if (num_tiles >= target_groups || k < 2 * min_size) { return 1; }
+  const auto num_splits = std::min(CeilDiv(target_groups, num_tiles), k / min_size);
+  const auto k_split_size = Ceil(CeilDiv(k, num_splits), db_["WGD"]);
+  return CeilDiv(k, k_split_size);
 }
+
+// The split-K version of GEMM: the first kernel computes alpha * A * B for each part of the
+// k-dimension into a temporary buffer, the second kernel sums the parts and adds beta * C.
+template <typename T>
+void Xgemm<T>::GemmSplitK(const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                          const bool a_conjugate, const bool b_conjugate,
+                          const size_t num_splits,
+                          EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Creates the temporary buffer holding the partial results
+  const auto k_split_size = Ceil(CeilDiv(k, num_splits), db_["WGD"]);
+  const auto partials = Buffer<T>(context_, num_splits * m * n);
+
+  // Retrieves the proper split-K kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectSplitKTT" : "XgemmDirectSplitKTN") :
+                                       (b_do_transpose ? "XgemmDirectSplitKNT" : "XgemmDirectSplitKNN");
+  auto kernel = Kernel(program_, name);
+
+  // Sets the kernel arguments. The partial results are written rather than accumulated (beta is 0)
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, static_cast<int>(k_split_size));
+  kernel.SetArgument(4, GetRealArg(alpha));
+  kernel.SetArgument(5, GetRealArg(ConstantZero<T>()));
+  kernel.SetArgument(6, a_buffer());
+  kernel.SetArgument(7, static_cast<int>(a_offset));
+  kernel.SetArgument(8, static_cast<int>(a_ld));
+  kernel.SetArgument(9, b_buffer());
+  kernel.SetArgument(10, static_cast<int>(b_offset));
+  kernel.SetArgument(11, static_cast<int>(b_ld));
+  kernel.SetArgument(12, partials());
+  kernel.SetArgument(13, static_cast<int>(a_conjugate));
+  kernel.SetArgument(14, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes: the third dimension covers the parts of k
+  const auto m_ceiled = Ceil(m, db_["WGD"]);
+  const auto n_ceiled = Ceil(n, db_["WGD"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
+    (n_ceiled * db_["NDIMCD"]) / db_["WGD"],
+    num_splits
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], 1};
+
+  // Launches the kernel
+  auto eventKernel = Event();
+  RunKernel(kernel, queue_, device_, global, local, eventKernel.pointer(), waitForEvents);
+
+  // Retrieves the reduction kernel and sets its arguments
+  auto reduce_kernel = Kernel(program_, "XgemmSplitKReduce");
+  reduce_kernel.SetArgument(0, static_cast<int>(m));
+  reduce_kernel.SetArgument(1, static_cast<int>(n));
+  reduce_kernel.SetArgument(2, static_cast<int>(num_splits));
+  reduce_kernel.SetArgument(3, GetRealArg(beta));
+  reduce_kernel.SetArgument(4, partials());
+  reduce_kernel.SetArgument(5, c_buffer());
+  reduce_kernel.SetArgument(6, static_cast<int>(c_offset));
+  reduce_kernel.SetArgument(7, static_cast<int>(c_ld));
+  reduce_kernel.SetArgument(8, static_cast<int>(c_do_transpose));
+
+  // Launches the reduction kernel after the first kernel has completed
+  const auto reduce_global = std::vector<size_t>{Ceil(m, 8), Ceil(n, 8)};
+  const auto reduce_local = std::vector<size_t>{8, 8};
+  auto eventWaitList = std::vector<Event>{eventKernel};
+  RunKernel(reduce_kernel, queue_, device_, reduce_global, reduce_local, event, eventWaitList);
+}
+
+// =================================================================================================
+
+// Determines the number of levels of the Strassen-Winograd version: each level halves m, n, and k,
+// all of which have to be at least the cut-off size from the database for the level to be applied
+template <typename T>
+size_t Xgemm<T>::GemmStrassenLevels(const size_t m, const size_t n, const size_t k) const {
+  const auto precision = PrecisionValue<T>();
+  if (strassen_active_ || GetAccuracyMode() != Accuracy::kReduced) { return 0; }
+  if (precision != Precision::kSingle && precision != Precision::kDouble) { return 0; }
+  if (HasEpilogue() || MirrorA() != kMirrorNone || MirrorB() != kMirrorNone) { return 0; }
+  if (db_["XGEMM_STRASSEN_MIN_SIZE"] == 0) { return 0; }
+  const auto min_size = std::max(db_["XGEMM_STRASSEN_MIN_SIZE"], size_t{2}); // non-empty blocks
+  auto levels = size_t{0};
+  auto m_level = m, n_level = n, k_level = k;
+  while (levels < kStrassenMaxLevels &&
+         m_level >= min_size && n_level >= min_size && k_level >= min_size) {
+    m_level /= 2;
+    n_level /= 2;
+    k_level /= 2;
+    levels++;
+  }
+  return levels;
+}
+
+// The Strassen-Winograd version of GEMM. All levels share a single temporary buffer: a level needs
+// two half-sized sub-matrices of C and one of A and B each, and the next levels run in between.
+template <typename T>
+void Xgemm<T>::GemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                            const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                            const size_t levels,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Computes the size of the temporary buffer for all levels together
+  auto temp_size = size_t{0};
+  auto m_level = m, n_level = n, k_level = k;
+  for (auto level = size_t{0}; level < levels; ++level) {
+    m_level /= 2;
+    n_level /= 2;
+    k_level /= 2;
+    temp_size += m_level * k_level + k_level * n_level + 2 * m_level * n_level;
+  }
+  const auto temp = Buffer<T>(context_, temp_size);
+
+  // Runs the recursion, the sub-products run the regular versions of GEMM through 'DoGemm'
+  strassen_active_ = true;
+  try {
+    StrassenLevel(layout, a_transpose, b_transpose, m, n, k, alpha,
+                  a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                  c_buffer, c_offset, c_ld,
+                  a_rotated, b_rotated, c_rotated, levels, temp, 0, event, waitForEvents);
+  } catch (...) {
+    strassen_active_ = false;
+    throw;
+  }
+  strassen_active_ = false;
+}
+
+// One level of the Strassen-Winograd version. The even-sized part of the matrices is split in 2x2
+// blocks and computed with 7 instead of 8 block products (Winograd's variant, with 15 additions).
+// An odd last row of C, column of C, and column of A and row of B are computed separately.
+template <typename T>
+void Xgemm<T>::StrassenLevel(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const T alpha,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                             const T beta,
+                             const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                             const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                             const size_t levels, const Buffer<T> &temp, const size_t temp_offset,
+                             EventPointer event, const std::vector<Event> &waitForEvents) {
+  if (levels == 0) {
+    DoGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+           a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+           c_buffer, c_offset, c_ld, event, waitForEvents);
+    return;
+  }
+  const auto one = ConstantOne<T>();
+  const auto zero = ConstantZero<T>();
+  const auto neg_one = ConstantNegOne<T>();
+
+  // The sizes of the blocks: 'mh' by 'kh' for A, 'kh' by 'nh' for B, and 'mh' by 'nh' for C
+  const auto mh = m / 2;
+  const auto nh = n / 2;
+  const auto kh = k / 2;
+
+  // Offsets of the blocks of A, B, and C (as seen in the non-transposed column-major product)
+  const auto block_offset = [](const size_t offset, const size_t ld, const bool rotated,
+                               const size_t row, const size_t col) {
+    return (rotated) ? offset + row * ld + col : offset + col * ld + row;
+  };
+  const auto a11 = a_offset;
+  const auto a12 = block_offset(a_offset, a_ld, a_rotated, 0, kh);
+  const auto a21 = block_offset(a_offset, a_ld, a_rotated, mh, 0);
+  const auto a22 = block_offset(a_offset, a_ld, a_rotated, mh, kh);
+  const auto b11 = b_offset;
+  const auto b12 = block_offset(b_offset, b_ld, b_rotated, 0, nh);
+  const auto b21 = block_offset(b_offset, b_ld, b_rotated, kh, 0);
+  const auto b22 = block_offset(b_offset, b_ld, b_rotated, kh, nh);
+  const auto c11 = c_offset;
+  const auto c12 = block_offset(c_offset, c_ld, c_rotated, 0, nh);
+  const auto c21 = block_offset(c_offset, c_ld, c_rotated, mh, 0);
+  const auto c22 = block_offset(c_offset, c_ld, c_rotated, mh, nh);
+
+  // The temporary blocks: S with the shape of the blocks of A, T of B, and W and X of C. They are
+  // stored in the same orientation as the original matrices.
+  const auto s_temp = temp_offset;
+  const auto t_temp = s_temp + mh * kh;
+  const auto w_temp = t_temp + kh * nh;
+  const auto x_temp = w_temp + mh * nh;
+  const auto next_temp = x_temp + mh * nh;
+  const auto s_ld = (a_rotated) ? kh : mh;
+  const auto t_ld = (b_rotated) ? nh : kh;
+  const auto w_ld = (c_rotated) ? nh : mh;
+
+  // The operations of this level, each of which is run after the previous has completed
+  using Operation = std::function<void(EventPointer, const std::vector<Event>&)>;
+  auto operations = std::vector<Operation>();
+  const auto product = [&](const Buffer<T> &a, const size_t a_off, const size_t a_ldx,
+                           const Buffer<T> &b, const size_t b_off, const size_t b_ldx,
+                           const T beta_x,
+                           const Buffer<T> &c, const size_t c_off, const size_t c_ldx) {
+    operations.push_back([=](EventPointer e, const std::vector<Event> &w) {
+      StrassenLevel(layout, a_transpose, b_transpose, mh, nh, kh, alpha,
+                    a, a_off, a_ldx, b, b_off, b_ldx, beta_x, c, c_off, c_ldx,
+                    a_rotated, b_rotated, c_rotated, levels - 1, temp, next_temp, e, w);
+    });
+  };
+  const auto add = [&](const size_t rows, const size_t cols, const bool rotated,
+                       const T alpha_x, const Buffer<T> &x, const size_t x_off, const size_t x_ldx,
+                       const T beta_y, const Buffer<T> &y, const size_t y_off, const size_t y_ldx,
+                       const Buffer<T> &d, const size_t d_off, const size_t d_ldx) {
+    operations.push_back([=](EventPointer e, const std::vector<Event> &w) {
+      StrassenAdd(e, w, rows, cols, rotated, alpha_x, x, x_off, x_ldx, beta_y, y, y_off, y_ldx,
+                  d, d_off, d_ldx);
+    });
+  };
+  const auto &a = a_buffer;
+  const auto &b = b_buffer;
+  const auto &c = c_buffer;
+
+  // C11 = W + beta * C11 + A12 * B21, with W = A11 * B11 (all products include alpha)
+  product(a, a11, a_ld, b, b11, b_ld, zero, temp, w_temp, w_ld);
+  add(mh, nh, c_rotated, one, temp, w_temp, w_ld, beta, c, c11, c_ld, c, c11, c_ld);
+  product(a, a12, a_ld, b, b21, b_ld, one, c, c11, c_ld);
+
+  // X = (A21 + A22) * (B12 - B11)
+  add(mh, kh, a_rotated, one, a, a21, a_ld, one, a, a22, a_ld, temp, s_temp, s_ld);
+  add(kh, nh, b_rotated, one, b, b12, b_ld, neg_one, b, b11, b_ld, temp, t_temp, t_ld);
+  product(temp, s_temp, s_ld, temp, t_temp, t_ld, zero, temp, x_temp, w_ld);
+
+  // W = W + (A21 + A22 - A11) * (B22 - B12 + B11)
+  add(mh, kh, a_rotated, one, temp, s_temp, s_ld, neg_one, a, a11, a_ld, temp, s_temp, s_ld);
+  add(kh, nh, b_rotated, one, b, b22, b_ld, neg_one, temp, t_temp, t_ld, temp, t_temp, t_ld);
+  product(temp, s_temp, s_ld, temp, t_temp, t_ld, one, temp, w_temp, w_ld);
+
+  // C12 = W + beta * C12 + X + (A12 - A21 - A22 + A11) * B22
+  add(mh, kh, a_rotated, one, a, a12, a_ld, neg_one, temp, s_temp, s_ld, temp, s_temp, s_ld);
+  add(mh, nh, c_rotated, one, temp, w_temp, w_ld, beta, c, c12, c_ld, c, c12, c_ld);
+  add(mh, nh, c_rotated, one, temp, x_temp, w_ld, one, c, c12, c_ld, c, c12, c_ld);
+  product(temp, s_temp, s_ld, b, b22, b_ld, one, c, c12, c_ld);
+
+  // C21 = beta * C21 + A22 * (B21 - B22 + B12 - B11), which is the negated Winograd term
+  add(kh, nh, b_rotated, one, b, b21, b_ld, neg_one, temp, t_temp, t_ld, temp, t_temp, t_ld);
+  product(a, a22, a_ld, temp, t_temp, t_ld, beta, c, c21, c_ld);
+
+  // W = W + (A11 - A21) * (B22 - B12), then C21 = C21 + W and C22 = W + beta * C22 + X
+  add(mh, kh, a_rotated, one, a, a11, a_ld, neg_one, a, a21, a_ld, temp, s_temp, s_ld);
+  add(kh, nh, b_rotated, one, b, b22, b_ld, neg_one, b, b12, b_ld, temp, t_temp, t_ld);
+  product(temp, s_temp, s_ld, temp, t_temp, t_ld, one, temp, w_temp, w_ld);
+  add(mh, nh, c_rotated, one, temp, w_temp, w_ld, one, c, c21, c_ld, c, c21, c_ld);
+  add(mh, nh, c_rotated, one, temp, w_temp, w_ld, beta, c, c22, c_ld, c, c22, c_ld);
+  add(mh, nh, c_rotated, one, temp, x_temp, w_ld, one, c, c22, c_ld, c, c22, c_ld);
+
+  // The remainders in case of odd sizes, computed with the regular versions of GEMM: the last
+  // column of A times the last row of B added to the even part of C, and the last row and column
+  // of C as a whole
+  const auto regular = [&](const size_t m_x, const size_t n_x, const size_t k_x,
+                           const size_t a_off, const size_t b_off, const T beta_x,
+                           const size_t c_off) {
+    operations.push_back([=](EventPointer e, const std::vector<Event> &w) {
+      DoGemm(layout, a_transpose, b_transpose, m_x, n_x, k_x, alpha,
+             a_buffer, a_off, a_ld, b_buffer, b_off, b_ld, beta_x, c_buffer, c_off, c_ld, e, w);
+    });
+  };
+  if (k % 2 == 1) {
+    regular(2 * mh, 2 * nh, 1, block_offset(a_offset, a_ld, a_rotated, 0, 2 * kh),
+            block_offset(b_offset, b_ld, b_rotated, 2 * kh, 0), one, c11);
+  }
+  if (m % 2 == 1) {
+    regular(1, n, k, block_offset(a_offset, a_ld, a_rotated, 2 * mh, 0), b11, beta,
+            block_offset(c_offset, c_ld, c_rotated, 2 * mh, 0));
+  }
+  if (n % 2 == 1) {
+    regular(2 * mh, 1, k, a11, block_offset(b_offset, b_ld, b_rotated, 0, 2 * nh), beta,
+            block_offset(c_offset, c_ld, c_rotated, 0, 2 * nh));
+  }
+
+  // Runs all operations in order, the last one signals the given event
+  auto eventWaitList = waitForEvents;
+  for (auto i = size_t{0}; i < operations.size(); ++i) {
+    if (i == operations.size() - 1) {
+      operations[i](event, eventWaitList);
+    }
+    else {
+      auto eventOperation = Event();
+      operations[i](eventOperation.pointer(), eventWaitList);
+      eventWaitList = std::vector<Event>{eventOperation};
+    }
+  }
+}
+
+// Computes dest := alpha * x + beta * y element-wise in the memory layout of the sub-matrices
+template <typename T>
+void Xgemm<T>::StrassenAdd(EventPointer event, const std::vector<Event> &waitForEvents,
+                           const size_t rows, const size_t cols, const bool rotated,
+                           const T alpha, const Buffer<T> &x, const size_t x_offset, const size_t x_ld,
+                           const T beta, const Buffer<T> &y, const size_t y_offset, const size_t y_ld,
+                           const Buffer<T> &dest, const size_t dest_offset, const size_t dest_ld) {
+  const auto one = (rotated) ? cols : rows;
+  const auto two = (rotated) ? rows : cols;
+  auto kernel = Kernel(program_, "XgemmStrassenAdd");
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, x());
+  kernel.SetArgument(4, static_cast<int>(x_offset));
+  kernel.SetArgument(5, static_cast<int>(x_ld));
+  kernel.SetArgument(6, GetRealArg(beta));
+  kernel.SetArgument(7, y());
+  kernel.SetArgument(8, static_cast<int>(y_offset));
+  kernel.SetArgument(9, static_cast<int>(y_ld));
+  kernel.SetArgument(10, dest());
+  kernel.SetArgument(11, static_cast<int>(dest_offset));
+  kernel.SetArgument(12, static_cast<int>(dest_ld));
+
+  // Uses the common padding kernel's thread configuration
+  const auto global = std::vector<size_t>{
+    Ceil(CeilDiv(one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+    Ceil(CeilDiv(two, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+  };
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// Populates the padded matrix for the in-direct kernel from a symmetric or hermitian matrix with
+// only one triangle stored, mirroring the other triangle (see 'convert_symmetric.opencl')
+template <typename T>
+void Xgemm<T>::MirrorPadMatrix(EventPointer event, const std::vector<Event> &waitForEvents,
+                               const int mirror, const size_t src_dim,
+                               const size_t src_ld, const size_t src_offset, const Buffer<T> &src,
+                               const size_t dest_one, const size_t dest_two, const Buffer<T> &dest,
+                               const bool do_transpose, const bool do_conjugate) {
+  auto kernel = Kernel(program_, "MirrorPadMatrix");
+  kernel.SetArgument(0, static_cast<int>(src_dim));
+  kernel.SetArgument(1, static_cast<int>(src_ld));
+  kernel.SetArgument(2, static_cast<int>(src_offset));
+  kernel.SetArgument(3, src());
+  kernel.SetArgument(4, static_cast<int>(dest_one));
+  kernel.SetArgument(5, static_cast<int>(dest_two));
+  kernel.SetArgument(6, static_cast<int>(dest_one));
+  kernel.SetArgument(7, 0);
+  kernel.SetArgument(8, dest());
+  kernel.SetArgument(9, mirror);
+  kernel.SetArgument(10, static_cast<int>(do_transpose));
+  kernel.SetArgument(11, static_cast<int>(do_conjugate));
+
+  // Uses the common padding kernel's thread configuration
+  const auto global = std::vector<size_t>{
+    Ceil(CeilDiv(dest_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+    Ceil(CeilDiv(dest_two, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+  };
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
 // =================================================================================================
 
 // Compiles the templated class
@@ -35,6 +35,16 @@ class Xgemm: public Routine {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+  // As above, but with a given output event and a list of events to wait for before starting, such
+  // that the GEMM can be chained with other kernels without synchronising with the host
+  void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+              const size_t m, const size_t n, const size_t k,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+              const T beta,
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              EventPointer event, const std::vector<Event> &waitForEvents);
  // Templated-precision implementation of the routine
   void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
               const size_t m, const size_t n, const size_t k,
@@ -54,7 +64,8 @@ class Xgemm: public Routine {
                     const bool a_conjugate, const bool b_conjugate,
                     const size_t a_one, const size_t a_two, const bool a_want_rotated,
                     const size_t b_one, const size_t b_two, const bool b_want_rotated,
-                    const size_t c_one, const size_t c_two, const bool c_want_rotated);
+                    const size_t c_one, const size_t c_two, const bool c_want_rotated,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
 // Indirect version of GEMM (with pre and post-processing kernels)
   void GemmIndirect(const size_t m, const size_t n, const size_t k,
                     const T alpha,
@@ -75,7 +86,100 @@ class Xgemm: public Routine {
                   const T beta,
                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                   const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                  const bool a_conjugate, const bool b_conjugate);
+                  const bool a_conjugate, const bool b_conjugate,
+                  EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Stream-K version of the in-direct GEMM kernel (persistent work-groups plus a fix-up kernel)
+  void GemmStreamK(const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled,
+                   const T alpha, const T beta,
+                   const Buffer<T> &a_temp, const Buffer<T> &b_temp, const Buffer<T> &c_temp,
+                   EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Split-K version of GEMM (partial results per part of the k-dimension plus a reduction kernel)
+  void GemmSplitK(const size_t m, const size_t n, const size_t k,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const T beta,
+                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                  const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                  const bool a_conjugate, const bool b_conjugate,
+                  const size_t num_splits,
+                  EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Returns the number of parts to split the k-dimension in, or one if splitting is not beneficial
+  size_t GemmSplitKCount(const size_t m, const size_t n, const size_t k) const;
+
+  // Strassen-Winograd version of GEMM for very large matrices: applies 'levels' levels of recursion
+  // on top of the other versions of GEMM, each replacing 8 half-sized products by 7 of them
+  void GemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                    const T beta,
+                    const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                    const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                    const size_t levels,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Returns the number of levels of Strassen-Winograd recursion, or zero if it is not used. This
+  // requires the reduced-accuracy mode (see SetAccuracy) and real single or double precision.
+  size_t GemmStrassenLevels(const size_t m, const size_t n, const size_t k) const;
+
+ protected:
+  // Hooks for routines which extend the storing of the results of the GEMM kernels, see the
+  // XgemmEpilogue routine: whether such an epilogue is compiled in, and the setting of its extra
+  // kernel arguments starting at argument 'index'. The split-K and stream-K versions are not used
+  // in combination with an epilogue.
+  virtual bool HasEpilogue() const { return false; }
+  virtual void SetEpilogueArguments(Kernel &, const size_t) const { }
+
+  // Hooks for routines of which matrix A or B is symmetric or hermitian with only one triangle
+  // stored, see the Xsymm and Xhemm routines: the stored triangle of matrix A and of matrix B as
+  // seen in column-major. The other triangle is mirrored on-the-fly by the direct kernel and by the
+  // pre-processing of the in-direct kernel. The split-K version is not used for such matrices.
+  static constexpr int kMirrorNone = 0;
+  static constexpr int kMirrorLower = 1;
+  static constexpr int kMirrorUpper = 2;
+  virtual int MirrorA() const { return kMirrorNone; }
+  virtual int MirrorB() const { return kMirrorNone; }
+
+ private:
+  // Maximum number of levels of the Strassen-Winograd version, the cut-off size is in the database
+  static constexpr size_t kStrassenMaxLevels = 2;
+
+  // Whether the Strassen-Winograd version is running, in which case its sub-products use the
+  // regular versions of GEMM
+  bool strassen_active_;
+
+  // One level of the Strassen-Winograd version (see above), using the temporary buffer from offset
+  // 'temp_offset' onwards for itself and for the next levels
+  void StrassenLevel(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const T alpha,
+                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                     const T beta,
+                     const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                     const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                     const size_t levels, const Buffer<T> &temp, const size_t temp_offset,
+                     EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Computes dest := alpha * x + beta * y for three rows-by-cols (sub-)matrices stored in the same
+  // orientation, as used by the Strassen-Winograd version
+  void StrassenAdd(EventPointer event, const std::vector<Event> &waitForEvents,
+                   const size_t rows, const size_t cols, const bool rotated,
+                   const T alpha, const Buffer<T> &x, const size_t x_offset, const size_t x_ld,
+                   const T beta, const Buffer<T> &y, const size_t y_offset, const size_t y_ld,
+                   const Buffer<T> &dest, const size_t dest_offset, const size_t dest_ld);
+
+  // Pre-processing of the in-direct kernel for a matrix with a mirrored triangle (see above)
+  void MirrorPadMatrix(EventPointer event, const std::vector<Event> &waitForEvents,
+                       const int mirror, const size_t src_dim,
+                       const size_t src_ld, const size_t src_offset, const Buffer<T> &src,
+                       const size_t dest_one, const size_t dest_two, const Buffer<T> &dest,
+                       const bool do_transpose, const bool do_conjugate);
 };
 
 // =================================================================================================
@@ -22,7 +22,8 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xhemm<T>::Xhemm(Queue &queue, EventPointer event, const std::string &name):
-    Xgemm<T>(queue, event, name) {
+    Xgemm<T>(queue, event, name),
+    mirror_a_(Xgemm<T>::kMirrorNone), mirror_b_(Xgemm<T>::kMirrorNone) {
 }
 
 // =================================================================================================
@@ -47,46 +48,21 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
   // Checks for validity of the squared A matrix
   TestMatrixA(k, k, a_buffer, a_offset, a_ld);
 
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
-  // default) and on whether we are dealing with an upper or lower triangle of the hermitian matrix
-  bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
-                   (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "HermUpperToSquared" : "HermLowerToSquared";
-
-  // Temporary buffer for a copy of the hermitian matrix
-  auto temp_herm = Buffer<T>(context_, k*k);
-
-  // Creates a general matrix from the hermitian matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the hermitian-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_herm());
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // hermitian-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
+  // Determines which triangle of the hermitian matrix holds the data based on the layout (the Xgemm
+  // kernel assumes column-major as default). The Xgemm kernels mirror the other triangle while
+  // loading the matrix, such that no squared copy of the hermitian matrix is needed.
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  auto &mirror = (side == Side::kLeft) ? mirror_a_ : mirror_b_;
+  if (is_upper) { mirror = kMirrorUpper; }
+  else { mirror = kMirrorLower; }
 
   // Runs the regular Xgemm code with either "C := AB+C" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, Transpose::kNo, Transpose::kNo,
            m, n, k,
            alpha,
-           temp_herm, 0, k,
+           a_buffer, a_offset, a_ld,
            b_buffer, b_offset, b_ld,
            beta,
            c_buffer, c_offset, c_ld);
@@ -99,7 +75,7 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
              m, n, k,
              alpha,
              b_buffer, b_offset, b_ld,
-             temp_herm, 0, k,
+             a_buffer, a_offset, a_ld,
              beta,
              c_buffer, c_offset, c_ld);
     } catch (BLASError &e) {
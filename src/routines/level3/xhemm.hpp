@@ -31,8 +31,12 @@ class Xhemm: public Xgemm<T> {
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::event_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::kMirrorNone;
+  using Xgemm<T>::kMirrorLower;
+  using Xgemm<T>::kMirrorUpper;
 
   // Constructor
   Xhemm(Queue &queue, EventPointer event, const std::string &name = "HEMM");
@@ -45,6 +49,16 @@ class Xhemm: public Xgemm<T> {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ protected:
+  // Mirrors the missing triangle of the hermitian matrix in the GEMM kernels, see the Xgemm routine
+  int MirrorA() const override { return mirror_a_; }
+  int MirrorB() const override { return mirror_b_; }
+
+ private:
+  // The stored triangle of the hermitian matrix, as either matrix A or B of the GEMM
+  int mirror_a_;
+  int mirror_b_;
 };
 
 // =================================================================================================
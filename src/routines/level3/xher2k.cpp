@@ -79,24 +79,20 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
   auto k_ceiled = Ceil(k, db_["KWG"]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
-  auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
+  const auto is_upper = (triangle == Triangle::kUpper);
+  auto kernel_name = (is_upper) ? "XgemmUpper" : "XgemmLower";
 
-  // Determines whether or not temporary matrices are needed
+  // Determines whether or not temporary matrices are needed. Only the conjugated version of one of
+  // the two matrices is needed: the second product B * A^H is computed by the kernel as the complex
+  // conjugate of conj(B) * A^T, re-using the same two matrices.
   auto a1_no_temp = ab_one == n_ceiled && ab_two == k_ceiled && a_ld == n_ceiled && a_offset == 0 &&
                     ab_rotated == false && ab_conjugate == false;
-  auto a2_no_temp = ab_one == n_ceiled && ab_two == k_ceiled && a_ld == n_ceiled && a_offset == 0 &&
-                    ab_rotated == false && ab_conjugate == true;
-  auto b1_no_temp = ab_one == n_ceiled && ab_two == k_ceiled && b_ld == n_ceiled && b_offset == 0 &&
-                    ab_rotated == false && ab_conjugate == false;
   auto b2_no_temp = ab_one == n_ceiled && ab_two == k_ceiled && b_ld == n_ceiled && b_offset == 0 &&
                     ab_rotated == false && ab_conjugate == true;
 
   // Creates the temporary matrices
   auto a1_temp = (a1_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-  auto a2_temp = (a2_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-  auto b1_temp = (b1_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
   auto b2_temp = (b2_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-  auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
 
   // Convert the arguments to complex versions
   auto complex_beta = T{beta, static_cast<U>(0.0)};
@@ -117,24 +113,6 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
                            true, ab_rotated, ab_conjugate);
     eventWaitList.push_back(eventProcessA1);
   }
-  if (!a2_no_temp) {
-    auto eventProcessA2 = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA2.pointer(), emptyEventList,
-                           ab_one, ab_two, a_ld, a_offset, a_buffer,
-                           n_ceiled, k_ceiled, n_ceiled, 0, a2_temp,
-                           ConstantOne<T>(), program_,
-                           true, ab_rotated, !ab_conjugate);
-    eventWaitList.push_back(eventProcessA2);
-  }
-  if (!b1_no_temp) {
-    auto eventProcessB1 = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB1.pointer(), emptyEventList,
-                           ab_one, ab_two, b_ld, b_offset, b_buffer,
-                           n_ceiled, k_ceiled, n_ceiled, 0, b1_temp,
-                           ConstantOne<T>(), program_,
-                           true, ab_rotated, ab_conjugate);
-    eventWaitList.push_back(eventProcessB1);
-  }
   if (!b2_no_temp) {
     auto eventProcessB2 = Event();
     PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB2.pointer(), emptyEventList,
@@ -145,61 +123,31 @@ void Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, const Tr
     eventWaitList.push_back(eventProcessB2);
   }
 
-  // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-  // modify the other triangle.
-  auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
-                         n, n, c_ld, c_offset, c_buffer,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                         ConstantOne<T>(), program_,
-                         true, c_rotated, false);
-  eventWaitList.push_back(eventProcessC);
-
   // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
   auto kernel = Kernel(program_, kernel_name);
 
-  // Sets the kernel arguments
+  // Sets the kernel arguments. The results are stored directly in the triangle of matrix C. The
+  // kernel computes both products, the second with the roles of the two matrices swapped.
   kernel.SetArgument(0, static_cast<int>(n_ceiled));
   kernel.SetArgument(1, static_cast<int>(k_ceiled));
   kernel.SetArgument(2, GetRealArg(alpha));
   kernel.SetArgument(3, GetRealArg(complex_beta));
   kernel.SetArgument(4, a1_temp());
   kernel.SetArgument(5, b2_temp());
-  kernel.SetArgument(6, c_temp());
-
-  // Computes the global and local thread sizes
-  auto global = std::vector<size_t>{
-    (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-    (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-  };
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(n));
+  kernel.SetArgument(8, static_cast<int>(c_offset));
+  kernel.SetArgument(9, static_cast<int>(c_ld));
+  kernel.SetArgument(10, static_cast<int>(c_rotated));
+
+  // Computes the global and local thread sizes: only the tiles holding elements of the triangle
+  // are launched, as a one-dimensional list of work-groups
+  const auto num_tiles = TriangleTileCount(n_ceiled, db_["MWG"], db_["NWG"], is_upper);
+  auto global = std::vector<size_t>{num_tiles * db_["MDIMC"], db_["NDIMC"]};
   auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
 
   // Launches the kernel
-  auto eventKernel1 = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel1.pointer(), eventWaitList);
-  eventWaitList.push_back(eventKernel1);
-
-  // Swaps the arguments for matrices A and B, sets 'beta' to 1, and conjugate alpha
-  auto conjugate_alpha = T{alpha.real(), -alpha.imag()};
-  auto complex_one = T{static_cast<U>(1.0), static_cast<U>(0.0)};
-  kernel.SetArgument(2, GetRealArg(conjugate_alpha));
-  kernel.SetArgument(3, GetRealArg(complex_one));
-  kernel.SetArgument(4, b1_temp());
-  kernel.SetArgument(5, a2_temp());
-
-  // Runs the kernel again
-  auto eventKernel2 = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel2.pointer(), eventWaitList);
-  eventWaitList.push_back(eventKernel2);
-
-  // Runs the post-processing kernel
-  auto upper = (triangle == Triangle::kUpper);
-  auto lower = (triangle == Triangle::kLower);
-  PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                         n, n, c_ld, c_offset, c_buffer,
-                         ConstantOne<T>(), program_,
-                         false, c_rotated, false, upper, lower, true);
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
 }
 
 // =================================================================================================
@@ -36,6 +36,14 @@ class Xherk: public Routine {
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const U beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+  // As above, but with a given output event and a list of events to wait for before starting
+  void DoHerk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+              const size_t n, const size_t k,
+              const U alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const U beta,
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              EventPointer event, const std::vector<Event> &waitForEvents);
 };
 
 // =================================================================================================
@@ -9,8 +9,8 @@
 //
 // This file implements the Xsymm routine. It is based on the generalized matrix multiplication
 // routine (Xgemm). The Xsymm class inherits from the templated class Xgemm, allowing it to call the
-// "DoGemm" function directly. The "DoSymm" function first preprocesses the symmetric matrix by
-// transforming it into a general matrix, and then calls the regular GEMM code.
+// "DoGemm" function directly. The "DoSymm" function calls the regular GEMM code on the stored
+// triangle of the symmetric matrix, of which the GEMM kernels mirror the other triangle on-the-fly.
 //
 // =================================================================================================
 
@@ -33,8 +33,12 @@ class Xsymm: public Xgemm<T> {
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::event_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::kMirrorNone;
+  using Xgemm<T>::kMirrorLower;
+  using Xgemm<T>::kMirrorUpper;
 
   // Constructor
   Xsymm(Queue &queue, EventPointer event, const std::string &name = "SYMM");
@@ -47,6 +51,16 @@ class Xsymm: public Xgemm<T> {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ protected:
+  // Mirrors the missing triangle of the symmetric matrix in the GEMM kernels, see the Xgemm routine
+  int MirrorA() const override { return mirror_a_; }
+  int MirrorB() const override { return mirror_b_; }
+
+ private:
+  // The stored triangle of the symmetric matrix, as either matrix A or B of the GEMM
+  int mirror_a_;
+  int mirror_b_;
 };
 
 // =================================================================================================
@@ -75,7 +75,8 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
   auto k_ceiled = Ceil(k, db_["KWG"]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
-  auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
+  const auto is_upper = (triangle == Triangle::kUpper);
+  auto kernel_name = (is_upper) ? "XgemmUpper" : "XgemmLower";
 
   // Determines whether or not temporary matrices are needed
   auto a_no_temp = ab_one == n_ceiled && ab_two == k_ceiled && a_ld == n_ceiled && a_offset == 0 &&
@@ -86,7 +87,6 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
   // Creates the temporary matrices
   auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
   auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-  auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
 
   // Events of all kernels (including pre/post processing kernels)
   auto eventWaitList = std::vector<Event>();
@@ -114,59 +114,31 @@ void Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, const Tran
     eventWaitList.push_back(eventProcessB);
   }
 
-  // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-  // modify the other triangle.
-  auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
-                         n, n, c_ld, c_offset, c_buffer,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                         ConstantOne<T>(), program_,
-                         true, c_rotated, false);
-  eventWaitList.push_back(eventProcessC);
-
   // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
   auto kernel = Kernel(program_, kernel_name);
 
-  // Sets the kernel arguments
+  // Sets the kernel arguments. The results are stored directly in the triangle of matrix C. The
+  // kernel computes both A * B^T and B * A^T.
   kernel.SetArgument(0, static_cast<int>(n_ceiled));
   kernel.SetArgument(1, static_cast<int>(k_ceiled));
   kernel.SetArgument(2, GetRealArg(alpha));
   kernel.SetArgument(3, GetRealArg(beta));
   kernel.SetArgument(4, a_temp());
   kernel.SetArgument(5, b_temp());
-  kernel.SetArgument(6, c_temp());
-
-  // Computes the global and local thread sizes
-  auto global = std::vector<size_t>{
-    (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-    (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-  };
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(n));
+  kernel.SetArgument(8, static_cast<int>(c_offset));
+  kernel.SetArgument(9, static_cast<int>(c_ld));
+  kernel.SetArgument(10, static_cast<int>(c_rotated));
+
+  // Computes the global and local thread sizes: only the tiles holding elements of the triangle
+  // are launched, as a one-dimensional list of work-groups
+  const auto num_tiles = TriangleTileCount(n_ceiled, db_["MWG"], db_["NWG"], is_upper);
+  auto global = std::vector<size_t>{num_tiles * db_["MDIMC"], db_["NDIMC"]};
   auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
 
   // Launches the kernel
-  auto eventKernel1 = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel1.pointer(), eventWaitList);
-  eventWaitList.push_back(eventKernel1);
-
-  // Swaps the arguments for matrices A and B, and sets 'beta' to 1
-  auto one = ConstantOne<T>();
-  kernel.SetArgument(3, GetRealArg(one));
-  kernel.SetArgument(4, b_temp());
-  kernel.SetArgument(5, a_temp());
-
-  // Runs the kernel again
-  auto eventKernel2 = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel2.pointer(), eventWaitList);
-  eventWaitList.push_back(eventKernel2);
-
-  // Runs the post-processing kernel
-  auto upper = (triangle == Triangle::kUpper);
-  auto lower = (triangle == Triangle::kLower);
-  PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                         n, n, c_ld, c_offset, c_buffer,
-                         ConstantOne<T>(), program_,
-                         false, c_rotated, false, upper, lower, false);
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
 }
 
 // =================================================================================================
@@ -9,7 +9,7 @@
 //
 // This file implements the Xsyr2k routine. The precision is implemented using a template argument.
 // The implementation is very similar to Xsyrk (see header for details), except for the fact that
-// the main XgemmUpper/XgemmLower kernel is called twice: C = AB^T + C and C = BA^T + C.
+// the main XgemmUpper/XgemmLower kernel computes two products: C = AB^T + BA^T + C.
 //
 // =================================================================================================
 
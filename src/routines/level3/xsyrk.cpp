@@ -44,6 +44,19 @@ void Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const Transp
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                             const T beta,
                             const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+  DoSyrk(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld,
+         beta, c_buffer, c_offset, c_ld, event_, std::vector<Event>());
+}
+
+// As above, but with a given output event and a list of events to wait for before starting
+template <typename T>
+void Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                      const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if ((n == 0) || (k == 0) ) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -72,7 +85,8 @@ void Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const Transp
   auto k_ceiled = Ceil(k, db_["KWG"]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
-  auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
+  const auto is_upper = (triangle == Triangle::kUpper);
+  auto kernel_name = (is_upper) ? "XgemmUpper" : "XgemmLower";
 
   // Determines whether or not temporary matrices are needed
   auto a_no_temp = a_one == n_ceiled && a_two == k_ceiled && a_ld == n_ceiled && a_offset == 0 &&
@@ -80,18 +94,16 @@ void Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const Transp
 
   // Creates the temporary matrices
   auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-  auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
 
-  // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  // Events of all kernels (including pre/post processing kernels), starting with the given ones
+  auto eventWaitList = waitForEvents;
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), waitForEvents,
                            a_one, a_two, a_ld, a_offset, a_buffer,
                            n_ceiled, k_ceiled, n_ceiled, 0, a_temp,
                            ConstantOne<T>(), program_,
@@ -99,48 +111,30 @@ void Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const Transp
     eventWaitList.push_back(eventProcessA);
   }
 
-  // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-  // modify the other triangle.
-  auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
-                         n, n, c_ld, c_offset, c_buffer,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                         ConstantOne<T>(), program_,
-                         true, c_rotated, false);
-  eventWaitList.push_back(eventProcessC);
-
   // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
   auto kernel = Kernel(program_, kernel_name);
 
-  // Sets the kernel arguments
+  // Sets the kernel arguments. The results are stored directly in the triangle of matrix C.
   kernel.SetArgument(0, static_cast<int>(n_ceiled));
   kernel.SetArgument(1, static_cast<int>(k_ceiled));
   kernel.SetArgument(2, GetRealArg(alpha));
   kernel.SetArgument(3, GetRealArg(beta));
   kernel.SetArgument(4, a_temp());
   kernel.SetArgument(5, a_temp());
-  kernel.SetArgument(6, c_temp());
-
-  // Computes the global and local thread sizes
-  auto global = std::vector<size_t>{
-    (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-    (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-  };
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(n));
+  kernel.SetArgument(8, static_cast<int>(c_offset));
+  kernel.SetArgument(9, static_cast<int>(c_ld));
+  kernel.SetArgument(10, static_cast<int>(c_rotated));
+
+  // Computes the global and local thread sizes: only the tiles holding elements of the triangle
+  // are launched, as a one-dimensional list of work-groups
+  const auto num_tiles = TriangleTileCount(n_ceiled, db_["MWG"], db_["NWG"], is_upper);
+  auto global = std::vector<size_t>{num_tiles * db_["MDIMC"], db_["NDIMC"]};
   auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
 
   // Launches the kernel
-  auto eventKernel = Event();
-  RunKernel(kernel, queue_, device_, global, local, eventKernel.pointer(), eventWaitList);
-  eventWaitList.push_back(eventKernel);
-
-  // Runs the post-processing kernel
-  auto upper = (triangle == Triangle::kUpper);
-  auto lower = (triangle == Triangle::kLower);
-  PadCopyTransposeMatrix(queue_, device_, db_, event_, eventWaitList,
-                         n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                         n, n, c_ld, c_offset, c_buffer,
-                         ConstantOne<T>(), program_,
-                         false, c_rotated, false, upper, lower, false);
+  RunKernel(kernel, queue_, device_, global, local, event, eventWaitList);
 }
 
 // =================================================================================================
@@ -9,9 +9,10 @@
 //
 // This file implements the Xsyrk routine. The precision is implemented using a template argument.
 // The implementation is based on the regular Xgemm routine and kernel, but with two main changes:
-// 1) The final unpad(transpose) kernel updates only the upper/lower triangular part.
-// 2) The main Xgemm kernel masks workgroups not contributing to usefull data. This is only for
-//    performance reasons, as the actual masking is done later (see the first point).
+// 1) Only the workgroups computing tiles which hold elements of the upper/lower triangle are
+//    launched, enumerated as a one-dimensional list of tiles.
+// 2) The results are stored directly in the upper/lower triangular part of matrix C, without the
+//    padded temporary copy of C and its pre and post-processing kernels.
 //
 // =================================================================================================
 
@@ -38,6 +39,14 @@ class Xsyrk: public Routine {
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+  // As above, but with a given output event and a list of events to wait for before starting
+  void DoSyrk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+              const size_t n, const size_t k,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const T beta,
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              EventPointer event, const std::vector<Event> &waitForEvents);
 };
 
 // =================================================================================================
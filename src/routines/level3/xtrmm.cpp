@@ -22,26 +22,32 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xtrmm<T>::Xtrmm(Queue &queue, EventPointer event, const std::string &name):
-    Xgemm<T>(queue, event, name) {
+    Xgemm<T>(queue, event, {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect",
+                            "KernelSelection","KernelSelectionSplitK","KernelSelectionStreamK",
+                            "KernelSelectionStrassen","KernelSelectionTrmm"}, name) {
 }
 
 // =================================================================================================
 
 // The main routine
 template <typename T>
-void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle triangle,
+void Xtrmm<T>::DoTrmm(const Layout layout, Side side, Triangle triangle,
                       const Transpose a_transpose, const Diagonal diagonal,
-                      const size_t m, const size_t n,
+                      size_t m, size_t n,
                       const T alpha,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
 
+  // Settings: the maximum size of the diagonal blocks which are multiplied as regular matrices
+  const auto block_size = static_cast<size_t>(db_["TRMM_BLOCK_SIZE"]);
+  if (block_size == 0) { throw BLASError(StatusCode::kInvalidValue, "TRMM_BLOCK_SIZE"); }
+
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
 
   // Computes the k dimension. This is based on whether or not matrix is A (on the left)
   // or B (on the right) in the Xgemm routine.
-  auto k = (side == Side::kLeft) ? m : n;
+  const auto k = (side == Side::kLeft) ? m : n;
 
   // Checks for validity of the triangular A matrix
   TestMatrixA(k, k, a_buffer, a_offset, a_ld);
@@ -51,87 +57,172 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   const auto b_two = (layout == Layout::kRowMajor) ? m : n;
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
-  const auto b_size = (b_ld * (b_two - 1) + b_one + b_offset);
-  auto b_buffer_copy = Buffer<T>(context_, b_size);
-  b_buffer.CopyTo(queue_, b_size, b_buffer_copy);
-
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
-  // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
-  bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
-                   (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
-
-  // Determines whether or not the triangular matrix is unit-diagonal
-  auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
-
-  // Temporary buffer for a copy of the triangular matrix
-  auto temp_triangular = Buffer<T>(context_, k*k);
-
-  // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the triangular-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_triangular());
-  kernel.SetArgument(8, static_cast<int>(unit_diagonal));
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // triangular-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
-
-  // Runs the regular Xgemm code with either "B := alpha*A*B" or ...
-  if (side == Side::kLeft) {
-    DoGemm(layout, a_transpose, Transpose::kNo,
-           m, n, k,
-           alpha,
-           temp_triangular, 0, k,
-           b_buffer_copy, b_offset, b_ld,
-           ConstantZero<T>(),
-           b_buffer, b_offset, b_ld);
+  // Converts row-major to a col-major problem: only the side (left/right) and the triangle
+  // (upper/lower) are changed and M/N are swapped, see the TRSM routine for details
+  if (layout == Layout::kRowMajor) {
+    std::swap(m, n);
+    side = (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+    triangle = (triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower;
   }
 
-  // ... with "B := alpha*B*A". Note that A and B are now reversed.
-  else {
-    try {
-      DoGemm(layout, Transpose::kNo, a_transpose,
-             m, n, k,
-             alpha,
-             b_buffer_copy, b_offset, b_ld,
-             temp_triangular, 0, k,
-             ConstantZero<T>(),
-             b_buffer, b_offset, b_ld);
-    } catch (BLASError &e) {
-      // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
-      switch(e.status()) {
-        case StatusCode::kInvalidMatrixA:      throw BLASError(StatusCode::kInvalidMatrixB, e.details());
-        case StatusCode::kInvalidMatrixB:      throw BLASError(StatusCode::kInvalidMatrixA, e.details());
-        case StatusCode::kInvalidLeadDimA:     throw BLASError(StatusCode::kInvalidLeadDimB, e.details());
-        case StatusCode::kInvalidLeadDimB:     throw BLASError(StatusCode::kInvalidLeadDimA, e.details());
-        case StatusCode::kInsufficientMemoryA: throw BLASError(StatusCode::kInsufficientMemoryB, e.details());
-        case StatusCode::kInsufficientMemoryB: throw BLASError(StatusCode::kInsufficientMemoryA, e.details());
-        default:                               throw;
-      }
+  // Derives properties based on the arguments: the first half of B depends on the second half for
+  // an upper triangular op(A) on the left-hand side or a lower triangular op(A) on the right-hand
+  // side, and the other way around otherwise
+  const auto is_upper = (triangle == Triangle::kUpper);
+  const auto is_op_upper = (is_upper == (a_transpose == Transpose::kNo));
+  const auto update_first_half = (side == Side::kLeft) ? is_op_upper : !is_op_upper;
+
+  // Temporary buffers for a regular matrix copy of a diagonal block of the triangular matrix and
+  // for a copy of the corresponding panel of B. These are reused for all diagonal blocks.
+  const auto panel_size = std::min(k, block_size);
+  auto temp_triangular = Buffer<T>(context_, panel_size * panel_size);
+  auto temp_panel = Buffer<T>(context_, panel_size * ((side == Side::kLeft) ? n : m));
+
+  // Runs all kernels chained through events, the host doesn't synchronise in between
+  try {
+    TrmmBlocks(side, is_upper, a_transpose, diagonal, update_first_half,
+               m, n, block_size, 0, k, alpha,
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+               temp_triangular, temp_panel, event_, std::vector<Event>());
+  } catch (BLASError &e) {
+    if (side == Side::kLeft) { throw; }
+    // A and B are reversed on the right-hand side, so also reverse the error codes returned from
+    // the Xgemm routine
+    switch(e.status()) {
+      case StatusCode::kInvalidMatrixA:      throw BLASError(StatusCode::kInvalidMatrixB, e.details());
+      case StatusCode::kInvalidMatrixB:      throw BLASError(StatusCode::kInvalidMatrixA, e.details());
+      case StatusCode::kInvalidLeadDimA:     throw BLASError(StatusCode::kInvalidLeadDimB, e.details());
+      case StatusCode::kInvalidLeadDimB:     throw BLASError(StatusCode::kInvalidLeadDimA, e.details());
+      case StatusCode::kInsufficientMemoryA: throw BLASError(StatusCode::kInsufficientMemoryB, e.details());
+      case StatusCode::kInsufficientMemoryB: throw BLASError(StatusCode::kInsufficientMemoryA, e.details());
+      default:                               throw;
     }
   }
 }
 
 // =================================================================================================
 
+// Recursive part of the routine: a range of rows or columns of B is split in two halves. The half
+// which depends on the other is first multiplied with its own diagonal part of A, after which the
+// off-diagonal part of A is added with a single GEMM. This reads the other half of B before that
+// half is updated itself, so no copy of B is needed. Single diagonal blocks are multiplied through
+// a regular matrix copy of the triangular block and a copy of the corresponding panel of B.
+template <typename T>
+void Xtrmm<T>::TrmmBlocks(const Side side, const bool is_upper, const Transpose a_transpose,
+                          const Diagonal diagonal, const bool update_first_half,
+                          const size_t m, const size_t n, const size_t block_size,
+                          const size_t start, const size_t size,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const Buffer<T> &temp_triangular, const Buffer<T> &temp_panel,
+                          EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Single diagonal block
+  if (size <= block_size) {
+
+    // Creates a general matrix from the triangular diagonal block. This uses the common padding
+    // kernel's thread configuration, which is allowed since the triangular-to-squared kernel uses
+    // the same parameters.
+    auto kernel = Kernel(program_, (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared");
+    kernel.SetArgument(0, static_cast<int>(size));
+    kernel.SetArgument(1, static_cast<int>(a_ld));
+    kernel.SetArgument(2, static_cast<int>(a_offset + start + start * a_ld));
+    kernel.SetArgument(3, a_buffer());
+    kernel.SetArgument(4, static_cast<int>(size));
+    kernel.SetArgument(5, static_cast<int>(size));
+    kernel.SetArgument(6, static_cast<int>(0));
+    kernel.SetArgument(7, temp_triangular());
+    kernel.SetArgument(8, static_cast<int>(diagonal == Diagonal::kUnit));
+    const auto global = std::vector<size_t>{Ceil(CeilDiv(size, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                            Ceil(CeilDiv(size, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+    const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+    auto kernel_event = Event();
+    RunKernel(kernel, queue_, device_, global, local, kernel_event.pointer(), waitForEvents);
+
+    // Copies the panel of B, such that it can be used as input while B is overwritten
+    const auto panel_one = (side == Side::kLeft) ? size : m;
+    const auto panel_two = (side == Side::kLeft) ? n : size;
+    const auto panel_offset = (side == Side::kLeft) ? b_offset + start : b_offset + start * b_ld;
+    auto copy_event = Event();
+    PadCopyTransposeMatrix(queue_, device_, db_, copy_event.pointer(), waitForEvents,
+                           panel_one, panel_two, b_ld, panel_offset, b_buffer,
+                           panel_one, panel_two, panel_one, 0, temp_panel,
+                           ConstantOne<T>(), program_, false, false, false);
+
+    // Runs the regular Xgemm code with either "B := alpha*A*B" or "B := alpha*B*A"
+    const auto eventWaitList = std::vector<Event>{kernel_event, copy_event};
+    if (side == Side::kLeft) {
+      DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+             size, n, size, alpha,
+             temp_triangular, 0, size,
+             temp_panel, 0, panel_one, ConstantZero<T>(),
+             b_buffer, panel_offset, b_ld,
+             event, eventWaitList);
+    }
+    else {
+      DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+             m, size, size, alpha,
+             temp_panel, 0, panel_one,
+             temp_triangular, 0, size, ConstantZero<T>(),
+             b_buffer, panel_offset, b_ld,
+             event, eventWaitList);
+    }
+    return;
+  }
+
+  // Splits the range in two halves, keeping the start of each half aligned to the block size
+  const auto first_size = Ceil(CeilDiv(size, size_t{2}), block_size);
+  const auto second_size = size - first_size;
+  const auto update_start = (update_first_half) ? start : start + first_size;
+  const auto update_size = (update_first_half) ? first_size : second_size;
+  const auto other_start = (update_first_half) ? start + first_size : start;
+  const auto other_size = (update_first_half) ? second_size : first_size;
+
+  // Multiplies the dependent half with its diagonal part of A
+  auto update_event = Event();
+  TrmmBlocks(side, is_upper, a_transpose, diagonal, update_first_half,
+             m, n, block_size, update_start, update_size, alpha,
+             a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+             temp_triangular, temp_panel, update_event.pointer(), waitForEvents);
+  auto eventWaitList = std::vector<Event>{update_event};
+
+  // Adds the contribution of the other half through the off-diagonal part of A with one GEMM:
+  // B := alpha * op(A) * B + B (left) or B := alpha * B * op(A) + B (right)
+  auto gemm_event = Event();
+  if (side == Side::kLeft) {
+    const auto this_a_offset = (a_transpose == Transpose::kNo) ?
+                               a_offset + update_start + other_start * a_ld :
+                               a_offset + other_start + update_start * a_ld;
+    DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+           update_size, n, other_size, alpha,
+           a_buffer, this_a_offset, a_ld,
+           b_buffer, b_offset + other_start, b_ld, ConstantOne<T>(),
+           b_buffer, b_offset + update_start, b_ld,
+           gemm_event.pointer(), eventWaitList);
+  }
+  else {
+    const auto this_a_offset = (a_transpose == Transpose::kNo) ?
+                               a_offset + other_start + update_start * a_ld :
+                               a_offset + update_start + other_start * a_ld;
+    DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+           m, update_size, other_size, alpha,
+           b_buffer, b_offset + other_start * b_ld, b_ld,
+           a_buffer, this_a_offset, a_ld, ConstantOne<T>(),
+           b_buffer, b_offset + update_start * b_ld, b_ld,
+           gemm_event.pointer(), eventWaitList);
+  }
+  eventWaitList = std::vector<Event>{gemm_event};
+
+  // Multiplies the other half with its diagonal part of A, now that it is no longer needed as input
+  TrmmBlocks(side, is_upper, a_transpose, diagonal, update_first_half,
+             m, n, block_size, other_start, other_size, alpha,
+             a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+             temp_triangular, temp_panel, event, eventWaitList);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xtrmm<half>;
 template class Xtrmm<float>;
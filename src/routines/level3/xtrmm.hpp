@@ -7,9 +7,10 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtrmm routine. The implementation is based on first transforming the
-// upper/lower unit/non-unit triangular matrix into a regular matrix and then calling the GEMM
-// routine. Therefore, this class inherits from the Xgemm class.
+// This file implements the Xtrmm routine. The implementation recursively splits the triangular
+// matrix in two halves: the off-diagonal part is processed by the GEMM routine, directly reading
+// from the triangular matrix and updating matrix B in-place. Only the small diagonal blocks are
+// transformed into regular matrices. Therefore, this class inherits from the Xgemm class.
 //
 // =================================================================================================
 
@@ -32,6 +33,7 @@ class Xtrmm: public Xgemm<T> {
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::event_;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
 
@@ -39,12 +41,26 @@ class Xtrmm: public Xgemm<T> {
   Xtrmm(Queue &queue, EventPointer event, const std::string &name = "TRMM");
 
   // Templated-precision implementation of the routine
-  void DoTrmm(const Layout layout, const Side side, const Triangle triangle,
+  void DoTrmm(const Layout layout, Side side, Triangle triangle,
               const Transpose a_transpose, const Diagonal diagonal,
-              const size_t m, const size_t n,
+              size_t m, size_t n,
               const T alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Recursively computes B := alpha * op(A) * B or B := alpha * B * op(A) in-place for the rows or
+  // columns [start, start + size) of B in column-major layout. The 'update_first_half' argument is
+  // set when the first half of B depends on the second half, rather than the other way around.
+  void TrmmBlocks(const Side side, const bool is_upper, const Transpose a_transpose,
+                  const Diagonal diagonal, const bool update_first_half,
+                  const size_t m, const size_t n, const size_t block_size,
+                  const size_t start, const size_t size,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const Buffer<T> &temp_triangular, const Buffer<T> &temp_panel,
+                  EventPointer event, const std::vector<Event> &waitForEvents);
 };
 
 // =================================================================================================
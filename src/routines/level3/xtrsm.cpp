@@ -26,7 +26,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xtrsm<T>::Xtrsm(Queue &queue, EventPointer event, const std::string &name):
-    Xgemm<T>(queue, event, name) {
+    Xgemm<T>(queue, event, {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect",
+                            "KernelSelection","KernelSelectionSplitK","KernelSelectionStreamK",
+                            "KernelSelectionStrassen","Invert"}, name) {
 }
 
 // =================================================================================================
@@ -39,6 +41,19 @@ void Xtrsm<T>::DoTrsm(const Layout layout, Side side, Triangle triangle,
                       const T alpha,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+  DoTrsm(layout, side, triangle, a_transpose, diagonal, m, n, alpha,
+         a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, event_, std::vector<Event>());
+}
+
+// As above, but with a given output event and a list of events to wait for before starting
+template <typename T>
+void Xtrsm<T>::DoTrsm(const Layout layout, Side side, Triangle triangle,
+                      const Transpose a_transpose, const Diagonal diagonal,
+                      size_t m, size_t n,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      EventPointer event, const std::vector<Event> &waitForEvents) {
 
   // Converts row-major to a col-major problem:
   // The idea is that
@@ -58,7 +73,8 @@ void Xtrsm<T>::DoTrsm(const Layout layout, Side side, Triangle triangle,
   TrsmColMajor(side, triangle, a_transpose, diagonal,
                m, n, alpha,
                a_buffer, a_offset, a_ld,
-               b_buffer, b_offset, b_ld);
+               b_buffer, b_offset, b_ld,
+               event, waitForEvents);
 }
 
 // =================================================================================================
@@ -70,10 +86,15 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
                             const size_t m, const size_t n,
                             const T alpha,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
-
-  // Settings
-  constexpr auto block_size = size_t{32}; // tuneable
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Settings: the block size is a multiple of the internal block size of the inversion kernels. It
+  // determines the work-group size of these kernels, so an invalid value is reported as such.
+  const auto block_size = static_cast<size_t>(db_["TRSM_BLOCK_SIZE"]);
+  if ((block_size < 16) || (block_size > 128) || ((block_size & (block_size - 1)) != 0)) {
+    throw BLASError(StatusCode::kInvalidLocalThreadsTotal, "TRSM_BLOCK_SIZE");
+  }
 
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -88,132 +109,131 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
   // Checks for validity of the input B matrix
   TestMatrixB(m, n, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
+  // Creates a copy of B to avoid overwriting input in GEMM while computing output. The output does
+  // not need to be zeroed: each block of X is written exactly once by a GEMM with a beta of zero.
   const auto b_size = b_ld * (n - 1) + m + b_offset;
-  const auto x_one = m;
-  const auto x_two = n;
   const auto x_size = b_size;
   const auto x_ld = b_ld;
   const auto x_offset = b_offset;
   auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
+  auto copy_event = Event();
+  b_buffer.CopyToAsync(queue_, x_size, x_buffer, copy_event.pointer(), waitForEvents);
 
-  // Temporary buffer for the inverse of the A matrix
+  // Temporary buffer for the inverses of the diagonal blocks of the A matrix
   const auto a_inv_size = Ceil(k, block_size) * block_size;
-  auto a_inv_buffer = Buffer<T>(context_, a_inv_size);
-
-  // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
-  auto fill_matrix_event = Event();
-  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), eventWaitList,
-             x_one, x_two, x_ld, x_offset, x_buffer, ConstantZero<T>());
-  fill_matrix_event.WaitForCompletion();
+  auto a_inv_buffer = Buffer<T>(context_, a_inv_size * block_size);
 
   // Inverts the diagonal blocks
   auto diagonal_invert_event = Event();
   auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
   inverter.InvertMatrixDiagonalBlocks(Layout::kColMajor, triangle, diagonal,
-                                      k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer);
-  diagonal_invert_event.WaitForCompletion();
+                                      k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer,
+                                      waitForEvents);
 
-  // Derives properties based on the arguments
+  // From here on all kernels are chained through events without synchronising with the host: the
+  // first GEMM waits for the above kernels, and each following GEMM for the one before it
+  auto eventWaitList = std::vector<Event>{copy_event, diagonal_invert_event};
+
+  // Derives properties based on the arguments: op(A) is lower triangular when 'condition' is set.
+  // The blocks of X are solved from first to last for a lower triangular op(A) on the left-hand
+  // side or an upper triangular op(A) on the right-hand side, and from last to first otherwise.
   const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
                           (triangle == Triangle::kLower && a_transpose == Transpose::kNo));
+  const auto forward = (side == Side::kLeft) ? condition : !condition;
 
-  // Left side
-  if (side == Side::kLeft) {
+  // Solves for all blocks of X at once
+  TrsmBlocks(side, a_transpose, forward, m, n, block_size, 0, k, alpha,
+             a_buffer, a_offset, a_ld, a_inv_buffer,
+             b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, eventWaitList);
 
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      for (auto i = size_t{0}; i < m; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(m - i, block_size);
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               current_block_size, n, current_block_size, gemm_alpha,
-               a_inv_buffer, i * block_size, block_size,
-               b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-               x_buffer, x_offset + i, x_ld);
-        if (i + block_size >= m) { break; }
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? (i + block_size) + i * a_ld : i + (block_size + i) * a_ld;
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               m - i - block_size, n, block_size, ConstantNegOne<T>(),
-               a_buffer, this_a_offset, a_ld,
-               x_buffer, x_offset + i, x_ld, gemm_alpha,
-               b_buffer, b_offset + i + block_size, b_ld);
-      }
-    }
+  // Retrieves the results
+  x_buffer.CopyToAsync(queue_, b_size, b_buffer, event, eventWaitList);
+}
+
+// =================================================================================================
 
-    // True when (upper triangular) or (lower triangular and transposed)
+// Recursive part of the routine: a range of blocks is split in two halves, of which one is solved
+// first. The other half is then updated with a single GEMM with the solved part of X and solved
+// recursively as well. A range of a single block is solved by multiplying with its inverse.
+template <typename T>
+void Xtrsm<T>::TrsmBlocks(const Side side, const Transpose a_transpose, const bool forward,
+                          const size_t m, const size_t n, const size_t block_size,
+                          const size_t start, const size_t size,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &a_inv_buffer,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                          std::vector<Event> &eventWaitList) {
+
+  // Single diagonal block: X := alpha * inv(op(A)) * B or X := alpha * B * inv(op(A))
+  if (size <= block_size) {
+    auto gemm_event = Event();
+    if (side == Side::kLeft) {
+      DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+             size, n, size, alpha,
+             a_inv_buffer, start * block_size, block_size,
+             b_buffer, b_offset + start, b_ld, ConstantZero<T>(),
+             x_buffer, x_offset + start, x_ld,
+             gemm_event.pointer(), eventWaitList);
+    }
     else {
-      const auto special_block_size = (m % block_size == 0) ? block_size : (m % block_size);
-      const auto i_start = static_cast<int>(m) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               current_block_size, n, current_block_size, gemm_alpha,
-               a_inv_buffer, i * block_size, block_size,
-               b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-               x_buffer, x_offset + i, x_ld);
-        if (i - static_cast<int>(block_size) < 0) { break; }
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i * a_ld : i;
-        DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-               i, n, current_block_size, ConstantNegOne<T>(),
-               a_buffer, this_a_offset, a_ld,
-               x_buffer, x_offset + i, x_ld, gemm_alpha,
-               b_buffer, b_offset, b_ld);
-      }
+      DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+             m, size, size, alpha,
+             b_buffer, b_offset + start * b_ld, b_ld,
+             a_inv_buffer, start * block_size, block_size, ConstantZero<T>(),
+             x_buffer, x_offset + start * x_ld, x_ld,
+             gemm_event.pointer(), eventWaitList);
     }
+    eventWaitList = std::vector<Event>{gemm_event};
+    return;
   }
 
-  // Right side
+  // Splits the range in two halves, keeping the start of each half aligned to the block size
+  const auto first_size = Ceil(CeilDiv(size, size_t{2}), block_size);
+  const auto second_size = size - first_size;
+  const auto solve_start = (forward) ? start : start + first_size;
+  const auto solve_size = (forward) ? first_size : second_size;
+  const auto update_start = (forward) ? start + first_size : start;
+  const auto update_size = (forward) ? second_size : first_size;
+
+  // Solves the half which does not depend on the other half
+  TrsmBlocks(side, a_transpose, forward, m, n, block_size, solve_start, solve_size, alpha,
+             a_buffer, a_offset, a_ld, a_inv_buffer,
+             b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, eventWaitList);
+
+  // Updates the other part of B with one large GEMM, which also applies the alpha scaling:
+  // B := alpha * B - op(A) * X (left) or B := alpha * B - X * op(A) (right)
+  auto gemm_event = Event();
+  if (side == Side::kLeft) {
+    const auto this_a_offset = (a_transpose == Transpose::kNo) ?
+                               a_offset + update_start + solve_start * a_ld :
+                               a_offset + solve_start + update_start * a_ld;
+    DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
+           update_size, n, solve_size, ConstantNegOne<T>(),
+           a_buffer, this_a_offset, a_ld,
+           x_buffer, x_offset + solve_start, x_ld, alpha,
+           b_buffer, b_offset + update_start, b_ld,
+           gemm_event.pointer(), eventWaitList);
+  }
   else {
-
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      const auto special_block_size = (n % block_size == 0) ? block_size : (n % block_size);
-      const auto i_start = static_cast<int>(n) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, current_block_size, current_block_size, gemm_alpha,
-               b_buffer, b_offset + i * b_ld, b_ld,
-               a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld);
-        if (i - static_cast<int>(block_size) < 0) { break; }
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i : i * a_ld;
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, i, current_block_size, ConstantNegOne<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld,
-               a_buffer, this_a_offset, a_ld, gemm_alpha,
-               b_buffer, b_offset, b_ld);
-      }
-    }
-
-    // True when (upper triangular) or (lower triangular and transposed)
-    else {
-      for (auto i = size_t{0}; i < n; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(n - i, block_size);
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, current_block_size, current_block_size, gemm_alpha,
-               b_buffer, b_offset + i * b_ld, b_ld,
-               a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld);
-        if (i + block_size >= n) { break; }
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i + (block_size + i) * a_ld : (i + block_size) + i * a_ld;
-        DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-               m, n - i - block_size, block_size, ConstantNegOne<T>(),
-               x_buffer, x_offset + i * x_ld, x_ld,
-               a_buffer, this_a_offset, a_ld, gemm_alpha,
-               b_buffer, b_offset + (i + block_size) * b_ld, b_ld);
-      }
-    }
+    const auto this_a_offset = (a_transpose == Transpose::kNo) ?
+                               a_offset + solve_start + update_start * a_ld :
+                               a_offset + update_start + solve_start * a_ld;
+    DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
+           m, update_size, solve_size, ConstantNegOne<T>(),
+           x_buffer, x_offset + solve_start * x_ld, x_ld,
+           a_buffer, this_a_offset, a_ld, alpha,
+           b_buffer, b_offset + update_start * b_ld, b_ld,
+           gemm_event.pointer(), eventWaitList);
   }
+  eventWaitList = std::vector<Event>{gemm_event};
 
-  // Retrieves the results
-  x_buffer.CopyTo(queue_, b_size, b_buffer);
+  // Solves the other half, for which alpha has already been applied
+  TrsmBlocks(side, a_transpose, forward, m, n, block_size, update_start, update_size,
+             ConstantOne<T>(),
+             a_buffer, a_offset, a_ld, a_inv_buffer,
+             b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, eventWaitList);
 }
 
 // =================================================================================================
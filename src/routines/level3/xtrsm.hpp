@@ -31,6 +31,7 @@ class Xtrsm: public Xgemm<T> {
   using Xgemm<T>::device_;
   using Xgemm<T>::db_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::event_;
   using Xgemm<T>::DoGemm;
 
   // Constructor
@@ -43,6 +44,14 @@ class Xtrsm: public Xgemm<T> {
               const T alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+  // As above, but with a given output event and a list of events to wait for before starting
+  void DoTrsm(const Layout layout, Side side, Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              size_t m, size_t n,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+              EventPointer event, const std::vector<Event> &waitForEvents);
 
   // Implementation of the column-major version
   void TrsmColMajor(const Side side, const Triangle triangle,
@@ -50,7 +59,21 @@ class Xtrsm: public Xgemm<T> {
                     const size_t m, const size_t n,
                     const T alpha,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
+
+ private:
+  // Recursively solves the blocks [start, start + size) in the k-dimension: the first half of the
+  // blocks is solved first when 'forward' is set, the second half otherwise
+  void TrsmBlocks(const Side side, const Transpose a_transpose, const bool forward,
+                  const size_t m, const size_t n, const size_t block_size,
+                  const size_t start, const size_t size,
+                  const T alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &a_inv_buffer,
+                  const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                  std::vector<Event> &eventWaitList);
 };
 
 // =================================================================================================
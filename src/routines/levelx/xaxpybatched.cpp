@@ -13,6 +13,7 @@
 
 #include "routines/levelx/xaxpybatched.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -46,33 +47,63 @@ void XaxpyBatched<T>::DoAxpyBatched(const size_t n, const std::vector<T> &alphas
   // Makes sure all dimensions are larger than zero
   if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
 
-  // Tests the vectors for validity
-  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
-    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
-    TestVectorY(n, y_buffer, y_offsets[batch], y_inc);
-  }
+  // Tests the vectors for validity. The required buffer size grows with the offset, so testing
+  // only the largest offset of each vector is equivalent to testing all batches individually.
+  const auto x_offset_max = *std::max_element(x_offsets.begin(), x_offsets.end());
+  const auto y_offset_max = *std::max_element(y_offsets.begin(), y_offsets.end());
+  TestVectorX(n, x_buffer, x_offset_max, x_inc);
+  TestVectorY(n, y_buffer, y_offset_max, y_inc);
 
-  // Upload the arguments to the device
+  // Copies the arguments to the device upon creation of the buffers, avoiding a synchronisation
   std::vector<int> x_offsets_int(x_offsets.begin(), x_offsets.end());
   std::vector<int> y_offsets_int(y_offsets.begin(), y_offsets.end());
-  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-  auto y_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadOnly, batch_count);
-  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
-  y_offsets_device.Write(queue_, batch_count, y_offsets_int);
-  alphas_device.Write(queue_, batch_count, alphas);
+  const auto x_offsets_device = Buffer<int>(context_, x_offsets_int);
+  const auto y_offsets_device = Buffer<int>(context_, y_offsets_int);
+  const auto alphas_device = Buffer<T>(context_, alphas);
+  BatchedAxpy(n, alphas_device, x_buffer, x_offsets_device, x_inc, y_buffer, y_offsets_device, y_inc,
+              batch_count);
+}
+
+// As above, but with the scalars and offsets already in device memory. Their values are unknown to
+// the host, so the vectors are tested for validity at an offset of zero only.
+template <typename T>
+void XaxpyBatched<T>::DoAxpyBatched(const size_t n, const Buffer<T> &alphas,
+                                    const Buffer<T> &x_buffer, const Buffer<int> &x_offsets, const size_t x_inc,
+                                    const Buffer<T> &y_buffer, const Buffer<int> &y_offsets, const size_t y_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  TestVectorX(n, x_buffer, 0, x_inc);
+  TestVectorY(n, y_buffer, 0, y_inc);
+  BatchedAxpy(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count);
+}
+
+// =================================================================================================
+
+// Launches the batched kernel: one row of work-groups per batch
+template <typename T>
+void XaxpyBatched<T>::BatchedAxpy(const size_t n, const Buffer<T> &alphas,
+                                  const Buffer<T> &x_buffer, const Buffer<int> &x_offsets, const size_t x_inc,
+                                  const Buffer<T> &y_buffer, const Buffer<int> &y_offsets, const size_t y_inc,
+                                  const size_t batch_count) {
 
   // Retrieves the Xaxpy kernel from the compiled binary
   auto kernel = Kernel(program_, "XaxpyBatched");
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(n));
-  kernel.SetArgument(1, alphas_device());
+  kernel.SetArgument(1, alphas());
   kernel.SetArgument(2, x_buffer());
-  kernel.SetArgument(3, x_offsets_device());
+  kernel.SetArgument(3, x_offsets());
   kernel.SetArgument(4, static_cast<int>(x_inc));
   kernel.SetArgument(5, y_buffer());
-  kernel.SetArgument(6, y_offsets_device());
+  kernel.SetArgument(6, y_offsets());
   kernel.SetArgument(7, static_cast<int>(y_inc));
 
   // Launches the kernel
@@ -34,6 +34,19 @@ class XaxpyBatched: public Routine {
                      const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
                      const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
                      const size_t batch_count);
+
+  // As above, but with the scalars and offsets already in device memory
+  void DoAxpyBatched(const size_t n, const Buffer<T> &alphas,
+                     const Buffer<T> &x_buffer, const Buffer<int> &x_offsets, const size_t x_inc,
+                     const Buffer<T> &y_buffer, const Buffer<int> &y_offsets, const size_t y_inc,
+                     const size_t batch_count);
+
+ private:
+  // Launches the batched kernel with all arguments in device memory
+  void BatchedAxpy(const size_t n, const Buffer<T> &alphas,
+                   const Buffer<T> &x_buffer, const Buffer<int> &x_offsets, const size_t x_inc,
+                   const Buffer<T> &y_buffer, const Buffer<int> &y_offsets, const size_t y_inc,
+                   const size_t batch_count);
 };
 
 // =================================================================================================
@@ -0,0 +1,156 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgemm3m class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemm3m.hpp"
+#include "routines/level3/xgemm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgemm3m<T>::Xgemm3m(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Pad"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/xgemm_3m.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgemm3m<T>::DoGemm3m(const Layout layout,
+                          const Transpose a_transpose, const Transpose b_transpose,
+                          const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes whether or not the matrices are transposed in memory. See GEMM routine for details.
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+
+  // Computes the first and second dimensions of the 3 matrices taking into account whether the
+  // matrices are rotated or not
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the matrices for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // The planes keep the memory layout of the complex matrices, so the real GEMMs take the same
+  // layout and transpose arguments. Conjugation is applied while splitting instead.
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+  const auto a_real_transpose = (a_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  const auto b_real_transpose = (b_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+
+  // Creates the temporary buffers: three consecutive real planes for each of the matrices
+  const auto a_plane_size = a_one * a_two;
+  const auto b_plane_size = b_one * b_two;
+  const auto c_plane_size = c_one * c_two;
+  auto a_planes = Buffer<real>(context_, 3 * a_plane_size);
+  auto b_planes = Buffer<real>(context_, 3 * b_plane_size);
+  auto c_planes = Buffer<real>(context_, 3 * c_plane_size);
+
+  // Splits matrices A and B into their real planes
+  auto a_split_event = Event();
+  SplitMatrix(a_split_event.pointer(), a_one, a_two, a_ld, a_offset, a_buffer, a_planes,
+              a_conjugate);
+  auto b_split_event = Event();
+  SplitMatrix(b_split_event.pointer(), b_one, b_two, b_ld, b_offset, b_buffer, b_planes,
+              b_conjugate);
+  const auto split_events = std::vector<Event>{a_split_event, b_split_event};
+
+  // Computes the three real products Re(A)*Re(B), Im(A)*Im(B) and (Re(A)+Im(A))*(Re(B)+Im(B))
+  auto gemm = Xgemm<real>(queue_, nullptr);
+  auto gemm_events = std::vector<Event>();
+  for (auto plane = size_t{0}; plane < 3; ++plane) {
+    auto gemm_event = Event();
+    gemm.DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k,
+                ConstantOne<real>(),
+                a_planes, plane * a_plane_size, a_one,
+                b_planes, plane * b_plane_size, b_one,
+                ConstantZero<real>(),
+                c_planes, plane * c_plane_size, c_one,
+                gemm_event.pointer(), split_events);
+    gemm_events.push_back(gemm_event);
+  }
+
+  // Recombines the real products into the complex result and applies alpha and beta
+  auto kernel = Kernel(program_, "Xgemm3mCombine");
+  kernel.SetArgument(0, static_cast<int>(c_one));
+  kernel.SetArgument(1, static_cast<int>(c_two));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, c_planes());
+  kernel.SetArgument(5, static_cast<int>(c_ld));
+  kernel.SetArgument(6, static_cast<int>(c_offset));
+  kernel.SetArgument(7, c_buffer());
+  const auto global = std::vector<size_t>{
+    Ceil(CeilDiv(c_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+    Ceil(CeilDiv(c_two, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+  };
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event_, gemm_events);
+}
+
+// =================================================================================================
+
+// Splits a complex matrix into three consecutive real planes, each with a leading dimension of 'one'
+template <typename T>
+void Xgemm3m<T>::SplitMatrix(EventPointer event, const size_t one, const size_t two,
+                             const size_t src_ld, const size_t src_offset, const Buffer<T> &src,
+                             const Buffer<real> &dest, const bool do_conjugate) {
+  auto kernel = Kernel(program_, "Xgemm3mSplit");
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, static_cast<int>(src_ld));
+  kernel.SetArgument(3, static_cast<int>(src_offset));
+  kernel.SetArgument(4, src());
+  kernel.SetArgument(5, dest());
+  kernel.SetArgument(6, static_cast<int>(do_conjugate));
+  const auto global = std::vector<size_t>{
+    Ceil(CeilDiv(one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+    Ceil(CeilDiv(two, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+  };
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event);
+}
+
+// =================================================================================================
+
+// Compiles the templated class (complex data-types only)
+template class Xgemm3m<float2>;
+template class Xgemm3m<double2>;
+
+// =================================================================================================
+} // namespace clblast
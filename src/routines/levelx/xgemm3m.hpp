@@ -0,0 +1,56 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgemm3m routine. This is a non-blas version of complex GEMM based on the
+// 3M method: the complex product is computed from three real GEMMs on the real and imaginary planes
+// of A and B, instead of from four real multiplications per complex multiply-accumulate. This saves
+// 25% of the arithmetic at the cost of extra memory traffic for splitting and recombining, so it
+// pays off for large matrices only. The real GEMMs are computed by the regular Xgemm routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMM3M_H_
+#define CLBLAST_ROUTINES_XGEMM3M_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgemm3m: public Routine {
+ public:
+
+  // Constructor
+  Xgemm3m(Queue &queue, EventPointer event, const std::string &name = "GEMM3M");
+
+  // Templated-precision implementation of the routine
+  void DoGemm3m(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+ private:
+  using real = typename BaseType<T>::Type;
+
+  // Splits a complex matrix into three consecutive real planes, see 'xgemm_3m.opencl'
+  void SplitMatrix(EventPointer event, const size_t one, const size_t two,
+                   const size_t src_ld, const size_t src_offset, const Buffer<T> &src,
+                   const Buffer<real> &dest, const bool do_conjugate);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMM3M_H_
+#endif
@@ -13,6 +13,7 @@
 
 #include "routines/levelx/xgemmbatched.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -23,7 +24,8 @@ namespace clblast {
 template <typename T>
 XgemmBatched<T>::XgemmBatched(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name,
-            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","KernelSelection"},
+            {"Copy","Pad","Transpose","Padtranspose","XgemmBatched","XgemmDirectBatched","KernelSelectionBatched",
+             "KernelSelectionSmallBatched"},
             PrecisionValue<T>(), {}, {
     #include "../../kernels/level3/level3.opencl"
     #include "../../kernels/level3/copy_fast.opencl"
@@ -41,6 +43,8 @@ XgemmBatched<T>::XgemmBatched(Queue &queue, EventPointer event, const std::strin
     , // separated in multiple parts to prevent C1091 in MSVC 2013
     #include "../../kernels/level3/xgemm_batched.opencl"
     #include "../../kernels/level3/xgemm_direct_batched.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_small_batched.opencl"
     }) {
 }
 
@@ -63,6 +67,71 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
     throw BLASError(StatusCode::kInvalidBatchCount);
   }
 
+  // Converts the offset to integers
+  std::vector<int> a_offsets_int(a_offsets.begin(), a_offsets.end());
+  std::vector<int> b_offsets_int(b_offsets.begin(), b_offsets.end());
+  std::vector<int> c_offsets_int(c_offsets.begin(), c_offsets.end());
+
+  // Copies the arguments to the device upon creation of the buffers, avoiding a synchronisation
+  const auto alphas_device = Buffer<T>(context_, alphas);
+  const auto betas_device = Buffer<T>(context_, betas);
+  const auto a_offsets_device = Buffer<int>(context_, a_offsets_int);
+  const auto b_offsets_device = Buffer<int>(context_, b_offsets_int);
+  const auto c_offsets_device = Buffer<int>(context_, c_offsets_int);
+
+  GemmBatched(layout, a_transpose, b_transpose, m, n, k, alphas_device,
+              a_buffer, a_offsets_device, a_offsets_int, a_ld,
+              b_buffer, b_offsets_device, b_offsets_int, b_ld, betas_device,
+              c_buffer, c_offsets_device, c_offsets_int, c_ld, batch_count);
+}
+
+// As above, but with the scalars and offsets already in device memory
+template <typename T>
+void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                    const size_t m, const size_t n, const size_t k,
+                                    const Buffer<T> &alphas,
+                                    const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                    const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                    const Buffer<T> &betas,
+                                    const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Tests the scalars and offsets for validity: each buffer needs to hold a value for every batch
+  TestVectorScalar(batch_count, alphas, 0);
+  TestVectorScalar(batch_count, betas, 0);
+  TestVectorIndex(batch_count, a_offsets, 0);
+  TestVectorIndex(batch_count, b_offsets, 0);
+  TestVectorIndex(batch_count, c_offsets, 0);
+
+  // The values of the offsets are unknown to the host
+  const auto unknown = std::vector<int>();
+  GemmBatched(layout, a_transpose, b_transpose, m, n, k, alphas,
+              a_buffer, a_offsets, unknown, a_ld,
+              b_buffer, b_offsets, unknown, b_ld, betas,
+              c_buffer, c_offsets, unknown, c_ld, batch_count);
+}
+
+// =================================================================================================
+
+// Shared implementation of the above. The host copies of the offsets are used for validation and to
+// avoid temporary buffers if possible. If they are empty, the matrices are only tested at an offset
+// of zero, and it is up to the caller to provide valid offsets.
+template <typename T>
+void XgemmBatched<T>::GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const Buffer<T> &alphas,
+                                  const Buffer<T> &a_buffer, const Buffer<int> &a_offsets,
+                                  const std::vector<int> &a_offsets_host, const size_t a_ld,
+                                  const Buffer<T> &b_buffer, const Buffer<int> &b_offsets,
+                                  const std::vector<int> &b_offsets_host, const size_t b_ld,
+                                  const Buffer<T> &betas,
+                                  const Buffer<T> &c_buffer, const Buffer<int> &c_offsets,
+                                  const std::vector<int> &c_offsets_host, const size_t c_ld,
+                                  const size_t batch_count) {
+
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
 
@@ -92,37 +161,48 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
   const auto c_one = (c_rotated) ? n : m;
   const auto c_two = (c_rotated) ? m : n;
 
-  // Tests the matrices for validity
-  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
-    TestMatrixA(a_one, a_two, a_buffer, a_offsets[batch], a_ld);
-    TestMatrixB(b_one, b_two, b_buffer, b_offsets[batch], b_ld);
-    TestMatrixC(c_one, c_two, c_buffer, c_offsets[batch], c_ld);
+  // Tests the matrices for validity. The required buffer size grows with the offset, so testing
+  // only the largest offset of each matrix is equivalent to testing all batches individually.
+  const auto max_offset = [](const std::vector<int> &offsets) {
+    if (offsets.empty()) { return size_t{0}; }
+    return static_cast<size_t>(*std::max_element(offsets.begin(), offsets.end()));
+  };
+  TestMatrixA(a_one, a_two, a_buffer, max_offset(a_offsets_host), a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, max_offset(b_offsets_host), b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, max_offset(c_offsets_host), c_ld);
+
+  // Tiny matrices are computed by a kernel specialised for their size, keeping C in registers. This
+  // is disabled if either of the 'KernelSelectionSmallBatched' parameters is zero.
+  const auto small_size = (db_["XGEMM_SMALL_BATCHED_WGS"] == 0) ? 0 :
+                          SmallBatchedGemmSize(m, n, k, db_["XGEMM_SMALL_BATCHED_MAX_SIZE"]);
+  if (small_size != 0) {
+    BatchedGemmSmall(small_size, m, n, k, alphas,
+                     a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                     betas, c_buffer, c_offsets, c_ld,
+                     a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                     batch_count);
+    return;
   }
 
-  // Upload the scalar arguments to the device
-  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadOnly, batch_count);
-  auto betas_device = Buffer<T>(context_, BufferAccess::kReadOnly, batch_count);
-  alphas_device.Write(queue_, batch_count, alphas);
-  betas_device.Write(queue_, batch_count, betas);
-
-  // Converts the offset to integers
-  std::vector<int> a_offsets_int(a_offsets.begin(), a_offsets.end());
-  std::vector<int> b_offsets_int(b_offsets.begin(), b_offsets.end());
-  std::vector<int> c_offsets_int(c_offsets.begin(), c_offsets.end());
-
-  // Selects which version of the batched GEMM to run
-  const auto do_gemm_direct = true;
+  // Selects which version of the batched GEMM to run: the direct kernel for a small total amount of
+  // work or in case padding to the tile sizes of the indirect kernel would more than double the work
+  const auto m_ceiled = Ceil(m, db_["MWG"]);
+  const auto n_ceiled = Ceil(n, db_["NWG"]);
+  const auto k_ceiled = Ceil(k, db_["KWG"]);
+  const auto do_gemm_direct = (batch_count * m * n * k < db_["XGEMM_BATCHED_MIN_INDIRECT_SIZE"]) ||
+                              (m_ceiled * n_ceiled * k_ceiled > 2 * m * n * k);
   if (do_gemm_direct) { // single generic kernel
-    BatchedGemmDirect(m, n, k, alphas_device,
-                      a_buffer, a_offsets_int, a_ld, b_buffer, b_offsets_int, b_ld,
-                      betas_device, c_buffer, c_offsets_int, c_ld,
+    BatchedGemmDirect(m, n, k, alphas,
+                      a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                      betas, c_buffer, c_offsets, c_ld,
                       a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                       batch_count);
   }
   else { // pre/post-processing plus a very fast kernel
-    BatchedGemmIndirect(m, n, k, alphas_device,
-                        a_buffer, a_offsets_int, a_ld, b_buffer, b_offsets_int, b_ld,
-                        betas_device, c_buffer, c_offsets_int, c_ld,
+    BatchedGemmIndirect(m, n, k, alphas,
+                        a_buffer, a_offsets, a_offsets_host, a_ld,
+                        b_buffer, b_offsets, b_offsets_host, b_ld,
+                        betas, c_buffer, c_offsets, c_offsets_host, c_ld,
                         a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                         a_one, a_two, a_want_rotated,
                         b_one, b_two, b_want_rotated,
@@ -140,10 +220,13 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
 template <typename T>
 void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const size_t k,
                                           const Buffer<T> &alphas,
-                                          const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                                          const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                                          const Buffer<T> &a_buffer, const Buffer<int> &a_offsets,
+                                          const std::vector<int> &a_offsets_host, const size_t a_ld,
+                                          const Buffer<T> &b_buffer, const Buffer<int> &b_offsets,
+                                          const std::vector<int> &b_offsets_host, const size_t b_ld,
                                           const Buffer<T> &betas,
-                                          const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                                          const Buffer<T> &c_buffer, const Buffer<int> &c_offsets,
+                                          const std::vector<int> &c_offsets_host, const size_t c_ld,
                                           const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                           const bool a_conjugate, const bool b_conjugate,
                                           const size_t a_one, const size_t a_two, const bool a_want_rotated,
@@ -174,12 +257,13 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
     c_offsets_i[batch] = batch * c_one_i * c_two_i;
   }
 
-  // Determines whether or not temporary matrices are needed
-  auto a_no_temp = a_one == a_one_i && a_two == a_two_i && a_ld == a_one && a_offsets == a_offsets_i &&
+  // Determines whether or not temporary matrices are needed. This requires the offsets to be known
+  // on the host: if they are not (empty vectors), temporary matrices are always used.
+  auto a_no_temp = a_one == a_one_i && a_two == a_two_i && a_ld == a_one && a_offsets_host == a_offsets_i &&
                    a_do_transpose == false && a_conjugate == false;
-  auto b_no_temp = b_one == b_one_i && b_two == b_two_i && b_ld == b_one && b_offsets == b_offsets_i &&
+  auto b_no_temp = b_one == b_one_i && b_two == b_two_i && b_ld == b_one && b_offsets_host == b_offsets_i &&
                    b_do_transpose == false && b_conjugate == false;
-  auto c_no_temp = c_one == c_one_i && c_two == c_two_i && c_ld == c_one && c_offsets == c_offsets_i &&
+  auto c_no_temp = c_one == c_one_i && c_two == c_two_i && c_ld == c_one && c_offsets_host == c_offsets_i &&
                    c_do_transpose == false;
 
   // Creates the temporary matrices
@@ -195,13 +279,10 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
-    auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-    auto a_offsets_i_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-    a_offsets_device.Write(queue_, batch_count, a_offsets);
-    a_offsets_i_device.Write(queue_, batch_count, a_offsets_i);
+    const auto a_offsets_i_device = Buffer<int>(context_, a_offsets_i);
     auto eventProcessA = Event();
     PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
-                                  a_one, a_two, a_ld, a_offsets_device, a_buffer,
+                                  a_one, a_two, a_ld, a_offsets, a_buffer,
                                   a_one_i, a_two_i, a_one_i, a_offsets_i_device, a_temp,
                                   program_, true, a_do_transpose, a_conjugate, batch_count);
     eventWaitList.push_back(eventProcessA);
@@ -209,27 +290,21 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 
   // As above, but now for matrix B
   if (!b_no_temp) {
-    auto b_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-    auto b_offsets_i_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-    b_offsets_device.Write(queue_, batch_count, b_offsets);
-    b_offsets_i_device.Write(queue_, batch_count, b_offsets_i);
+    const auto b_offsets_i_device = Buffer<int>(context_, b_offsets_i);
     auto eventProcessB = Event();
     PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
-                                  b_one, b_two, b_ld, b_offsets_device, b_buffer,
+                                  b_one, b_two, b_ld, b_offsets, b_buffer,
                                   b_one_i, b_two_i, b_one_i, b_offsets_i_device, b_temp,
                                   program_, true, b_do_transpose, b_conjugate, batch_count);
     eventWaitList.push_back(eventProcessB);
   }
 
   // As above, but now for matrix C
-  auto c_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-  auto c_offsets_i_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  const auto c_offsets_i_device = Buffer<int>(context_, c_offsets_i);
   if (!c_no_temp) {
-    c_offsets_device.Write(queue_, batch_count, c_offsets);
-    c_offsets_i_device.Write(queue_, batch_count, c_offsets_i);
     auto eventProcessC = Event();
     PadCopyTransposeMatrixBatched(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
-                                  c_one, c_two, c_ld, c_offsets_device, c_buffer,
+                                  c_one, c_two, c_ld, c_offsets, c_buffer,
                                   c_one_i, c_two_i, c_one_i, c_offsets_i_device, c_temp,
                                   program_, true, c_do_transpose, false, batch_count);
     eventWaitList.push_back(eventProcessC);
@@ -272,7 +347,7 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
     eventWaitList.push_back(eventKernel);
     PadCopyTransposeMatrixBatched(queue_, device_, db_, event_, eventWaitList,
                                   c_one_i, c_two_i, c_one_i, c_offsets_i_device, c_temp,
-                                  c_one, c_two, c_ld, c_offsets_device, c_buffer,
+                                  c_one, c_two, c_ld, c_offsets, c_buffer,
                                   program_, false, c_do_transpose, false, batch_count);
   }
 }
@@ -283,22 +358,14 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 template <typename T>
 void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
                                         const Buffer<T> &alphas,
-                                        const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                                        const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                                        const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                        const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
                                         const Buffer<T> &betas,
-                                        const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                                        const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
                                         const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                         const bool a_conjugate, const bool b_conjugate,
                                         const size_t batch_count) {
 
-  // Uploads the offsets to the device
-  auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-  auto b_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-  auto c_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
-  a_offsets_device.Write(queue_, batch_count, a_offsets);
-  b_offsets_device.Write(queue_, batch_count, b_offsets);
-  c_offsets_device.Write(queue_, batch_count, c_offsets);
-
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectBatchedTT" : "XgemmDirectBatchedTN") :
                                        (b_do_transpose ? "XgemmDirectBatchedNT" : "XgemmDirectBatchedNN");
@@ -311,13 +378,13 @@ void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const si
   kernel.SetArgument(3, alphas());
   kernel.SetArgument(4, betas());
   kernel.SetArgument(5, a_buffer());
-  kernel.SetArgument(6, a_offsets_device());
+  kernel.SetArgument(6, a_offsets());
   kernel.SetArgument(7, static_cast<int>(a_ld));
   kernel.SetArgument(8, b_buffer());
-  kernel.SetArgument(9, b_offsets_device());
+  kernel.SetArgument(9, b_offsets());
   kernel.SetArgument(10, static_cast<int>(b_ld));
   kernel.SetArgument(11, c_buffer());
-  kernel.SetArgument(12, c_offsets_device());
+  kernel.SetArgument(12, c_offsets());
   kernel.SetArgument(13, static_cast<int>(c_ld));
   kernel.SetArgument(14, static_cast<int>(c_do_transpose));
   kernel.SetArgument(15, static_cast<int>(a_conjugate));
@@ -339,6 +406,54 @@ void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const si
 
 // =================================================================================================
 
+// The tiny-matrix version of batched GEMM. Each thread computes a row of a C matrix, such that a
+// work-group processes several matrices at once.
+template <typename T>
+void XgemmBatched<T>::BatchedGemmSmall(const size_t size, const size_t m, const size_t n, const size_t k,
+                                       const Buffer<T> &alphas,
+                                       const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                       const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                       const Buffer<T> &betas,
+                                       const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                       const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                                       const bool a_conjugate, const bool b_conjugate,
+                                       const size_t batch_count) {
+
+  // Retrieves the kernel specialised for the given size from the compiled binary
+  auto kernel = Kernel(program_, "XgemmSmallBatched" + ToString(size));
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, alphas());
+  kernel.SetArgument(4, betas());
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, a_offsets());
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, b_buffer());
+  kernel.SetArgument(9, b_offsets());
+  kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, c_offsets());
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+  kernel.SetArgument(14, static_cast<int>(a_do_transpose));
+  kernel.SetArgument(15, static_cast<int>(b_do_transpose));
+  kernel.SetArgument(16, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(17, static_cast<int>(a_conjugate));
+  kernel.SetArgument(18, static_cast<int>(b_conjugate));
+  kernel.SetArgument(19, static_cast<int>(batch_count));
+
+  // Computes the global and local thread sizes: one thread per row of each matrix
+  const auto global = std::vector<size_t>{Ceil(size * batch_count, db_["XGEMM_SMALL_BATCHED_WGS"])};
+  const auto local = std::vector<size_t>{db_["XGEMM_SMALL_BATCHED_WGS"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class XgemmBatched<half>;
 template class XgemmBatched<float>;
@@ -39,13 +39,26 @@ class XgemmBatched: public Routine {
                      const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets, const size_t c_ld,
                      const size_t batch_count);
 
+  // As above, but with the scalars and offsets already in device memory
+  void DoGemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const Buffer<T> &alphas,
+                     const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                     const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                     const Buffer<T> &betas,
+                     const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                     const size_t batch_count);
+
   // Indirect version of batched GEMM (with pre and post-processing kernels)
   void BatchedGemmIndirect(const size_t m, const size_t n, const size_t k,
                            const Buffer<T> &alphas,
-                           const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                           const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                           const Buffer<T> &a_buffer, const Buffer<int> &a_offsets,
+                           const std::vector<int> &a_offsets_host, const size_t a_ld,
+                           const Buffer<T> &b_buffer, const Buffer<int> &b_offsets,
+                           const std::vector<int> &b_offsets_host, const size_t b_ld,
                            const Buffer<T> &betas,
-                           const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                           const Buffer<T> &c_buffer, const Buffer<int> &c_offsets,
+                           const std::vector<int> &c_offsets_host, const size_t c_ld,
                            const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                            const bool a_conjugate, const bool b_conjugate,
                            const size_t a_one, const size_t a_two, const bool a_want_rotated,
@@ -56,13 +69,39 @@ class XgemmBatched: public Routine {
   // Direct version of batched GEMM (no pre and post-processing kernels)
   void BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
                          const Buffer<T> &alphas,
-                         const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                         const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                         const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                         const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
                          const Buffer<T> &betas,
-                         const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                         const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                          const bool a_conjugate, const bool b_conjugate,
                          const size_t batch_count);
+
+  // Version of batched GEMM for tiny matrices, using the kernel specialised for the given size
+  void BatchedGemmSmall(const size_t size, const size_t m, const size_t n, const size_t k,
+                        const Buffer<T> &alphas,
+                        const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                        const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                        const Buffer<T> &betas,
+                        const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                        const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                        const bool a_conjugate, const bool b_conjugate,
+                        const size_t batch_count);
+
+ private:
+  // Shared implementation of the two versions of the main routine. The host copies of the offsets
+  // are empty in case they are not known.
+  void GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const Buffer<T> &alphas,
+                   const Buffer<T> &a_buffer, const Buffer<int> &a_offsets,
+                   const std::vector<int> &a_offsets_host, const size_t a_ld,
+                   const Buffer<T> &b_buffer, const Buffer<int> &b_offsets,
+                   const std::vector<int> &b_offsets_host, const size_t b_ld,
+                   const Buffer<T> &betas,
+                   const Buffer<T> &c_buffer, const Buffer<int> &c_offsets,
+                   const std::vector<int> &c_offsets_host, const size_t c_ld,
+                   const size_t batch_count);
 };
 
 // =================================================================================================
@@ -0,0 +1,110 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmEpilogue class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmepilogue.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmEpilogue<T>::XgemmEpilogue(Queue &queue, EventPointer event, const std::string &name):
+    Xgemm<T>(queue, event, name),
+    m_(0), n_(0),
+    bias_mode_(EpilogueMode::kNone), bias_buffer_(nullptr), bias_offset_(0),
+    activation_(Activation::kNone), clip_min_(ConstantZero<T>()), clip_max_(ConstantZero<T>()),
+    scale_mode_(EpilogueMode::kNone), scale_buffer_(nullptr), scale_offset_(0) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmEpilogue<T>::DoGemmEpilogue(const Layout layout,
+                                      const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const T alpha,
+                                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const T beta,
+                                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                                      const EpilogueMode bias_mode, const Buffer<T> &bias_buffer,
+                                      const size_t bias_offset,
+                                      const Activation activation, const T clip_min, const T clip_max,
+                                      const EpilogueMode scale_mode, const Buffer<T> &scale_buffer,
+                                      const size_t scale_offset) {
+
+  // Tests the bias and scaling vectors for validity: one element per row or per column of C
+  if (bias_mode != EpilogueMode::kNone) {
+    const auto bias_size = (bias_mode == EpilogueMode::kPerRow) ? m : n;
+    TestVectorBias(bias_size, bias_buffer, bias_offset);
+  }
+  if (scale_mode != EpilogueMode::kNone) {
+    const auto scale_size = (scale_mode == EpilogueMode::kPerRow) ? m : n;
+    TestVectorScale(scale_size, scale_buffer, scale_offset);
+  }
+
+  // Unused vectors are replaced by a single-element dummy buffer to have valid kernel arguments. It
+  // is kept alive until the GEMM kernels are launched below.
+  const auto needs_dummy = (bias_mode == EpilogueMode::kNone || scale_mode == EpilogueMode::kNone);
+  const auto dummy_buffer = (needs_dummy) ? Buffer<T>(context_, 1) : bias_buffer;
+
+  // Stores the epilogue arguments
+  m_ = m;
+  n_ = n;
+  bias_mode_ = bias_mode;
+  bias_buffer_ = (bias_mode != EpilogueMode::kNone) ? bias_buffer() : dummy_buffer();
+  bias_offset_ = bias_offset;
+  activation_ = activation;
+  clip_min_ = clip_min;
+  clip_max_ = clip_max;
+  scale_mode_ = scale_mode;
+  scale_buffer_ = (scale_mode != EpilogueMode::kNone) ? scale_buffer() : dummy_buffer();
+  scale_offset_ = scale_offset;
+
+  // Runs the regular GEMM routine, which compiles the epilogue into its kernels
+  DoGemm(layout, a_transpose, b_transpose, m, n, k,
+         alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+         beta, c_buffer, c_offset, c_ld);
+}
+
+// =================================================================================================
+
+// Sets the extra arguments of the GEMM kernels, see 'xgemm_epilogue.opencl' for their order
+template <typename T>
+void XgemmEpilogue<T>::SetEpilogueArguments(Kernel &kernel, const size_t index) const {
+  kernel.SetArgument(index + 0, static_cast<int>(m_));
+  kernel.SetArgument(index + 1, static_cast<int>(n_));
+  kernel.SetArgument(index + 2, bias_buffer_);
+  kernel.SetArgument(index + 3, static_cast<int>(bias_offset_));
+  kernel.SetArgument(index + 4, static_cast<int>(bias_mode_));
+  kernel.SetArgument(index + 5, static_cast<int>(activation_));
+  kernel.SetArgument(index + 6, GetRealArg(clip_min_));
+  kernel.SetArgument(index + 7, GetRealArg(clip_max_));
+  kernel.SetArgument(index + 8, scale_buffer_);
+  kernel.SetArgument(index + 9, static_cast<int>(scale_offset_));
+  kernel.SetArgument(index + 10, static_cast<int>(scale_mode_));
+}
+
+// =================================================================================================
+
+// Compiles the templated class (real data-types only)
+template class XgemmEpilogue<half>;
+template class XgemmEpilogue<float>;
+template class XgemmEpilogue<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,73 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmEpilogue routine. This is a non-blas version of GEMM with a fused
+// epilogue: an optional bias vector is added, an activation function is applied, and the result is
+// multiplied with an optional vector of scaling factors, all before the results are written. The
+// epilogue is compiled into the regular GEMM kernels, such that no extra passes over C are needed.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMEPILOGUE_H_
+#define CLBLAST_ROUTINES_XGEMMEPILOGUE_H_
+
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmEpilogue: public Xgemm<T> {
+ public:
+
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::context_;
+  using Xgemm<T>::DoGemm;
+
+  // Constructor
+  XgemmEpilogue(Queue &queue, EventPointer event, const std::string &name = "GEMMEPILOGUE");
+
+  // Templated-precision implementation of the routine
+  void DoGemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      const EpilogueMode bias_mode, const Buffer<T> &bias_buffer, const size_t bias_offset,
+                      const Activation activation, const T clip_min, const T clip_max,
+                      const EpilogueMode scale_mode, const Buffer<T> &scale_buffer, const size_t scale_offset);
+
+ protected:
+  // Enables the epilogue in the GEMM kernels, see the Xgemm routine
+  bool HasEpilogue() const override { return true; }
+  void SetEpilogueArguments(Kernel &kernel, const size_t index) const override;
+
+ private:
+  // The epilogue arguments of the current call
+  size_t m_;
+  size_t n_;
+  EpilogueMode bias_mode_;
+  cl_mem bias_buffer_;
+  size_t bias_offset_;
+  Activation activation_;
+  T clip_min_;
+  T clip_max_;
+  EpilogueMode scale_mode_;
+  cl_mem scale_buffer_;
+  size_t scale_offset_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMEPILOGUE_H_
+#endif
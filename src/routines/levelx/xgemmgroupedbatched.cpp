@@ -0,0 +1,157 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGroupedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmgroupedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmGroupedBatched<T>::XgemmGroupedBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmDirectBatched"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/level3.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_direct_part1.opencl"
+    #include "../../kernels/level3/xgemm_direct_part2.opencl"
+    #include "../../kernels/level3/xgemm_direct_part3.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_direct_batched.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmGroupedBatched<T>::DoGemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                  const std::vector<size_t> &ms, const std::vector<size_t> &ns,
+                                                  const std::vector<size_t> &ks,
+                                                  const std::vector<T> &alphas,
+                                                  const Buffer<T> & a_buffer, const std::vector<size_t> &a_offsets, const std::vector<size_t> &a_lds,
+                                                  const Buffer<T> & b_buffer, const std::vector<size_t> &b_offsets, const std::vector<size_t> &b_lds,
+                                                  const std::vector<T> &betas,
+                                                  const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets, const std::vector<size_t> &c_lds,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (ms.size() != batch_count) || (ns.size() != batch_count) ||
+      (ks.size() != batch_count) || (alphas.size() != batch_count) || (betas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (b_offsets.size() != batch_count) || (c_offsets.size() != batch_count) ||
+      (a_lds.size() != batch_count) || (b_lds.size() != batch_count) || (c_lds.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Computes whether or not the matrices are transposed in memory. See GEMM routine for details.
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  static const auto a_want_rotated = false;
+  static const auto b_want_rotated = true;
+  static const auto c_want_rotated = false;
+  const auto a_do_transpose = a_rotated != a_want_rotated;
+  const auto b_do_transpose = b_rotated != b_want_rotated;
+  const auto c_do_transpose = c_rotated != c_want_rotated;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Tests all batches for validity and builds the work table. Each work-group computes a single
+  // WGD by WGD tile of C, such that all batches are processed in one kernel launch and large and
+  // small batches are spread evenly over the work-groups. The table holds for each batch its first
+  // tile, its sizes, and its offsets and leading dimensions, stored field-by-field.
+  const auto wgd = db_["WGD"];
+  auto work_table = std::vector<int>(kWorkTableFields * batch_count);
+  auto num_tiles = size_t{0};
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    const auto m = ms[batch];
+    const auto n = ns[batch];
+    const auto k = ks[batch];
+
+    // Makes sure all dimensions are larger than zero
+    if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+    // Computes the first and second dimensions of the 3 matrices taking into account whether the
+    // matrices are rotated or not
+    const auto a_one = (a_rotated) ? k : m;
+    const auto a_two = (a_rotated) ? m : k;
+    const auto b_one = (b_rotated) ? n : k;
+    const auto b_two = (b_rotated) ? k : n;
+    const auto c_one = (c_rotated) ? n : m;
+    const auto c_two = (c_rotated) ? m : n;
+
+    // Tests the matrices for validity
+    TestMatrixA(a_one, a_two, a_buffer, a_offsets[batch], a_lds[batch]);
+    TestMatrixB(b_one, b_two, b_buffer, b_offsets[batch], b_lds[batch]);
+    TestMatrixC(c_one, c_two, c_buffer, c_offsets[batch], c_lds[batch]);
+
+    // Adds the batch to the work table
+    const auto fields = std::vector<size_t>{
+      num_tiles, m, n, k,
+      a_offsets[batch], a_lds[batch], b_offsets[batch], b_lds[batch], c_offsets[batch], c_lds[batch]
+    };
+    for (auto field = size_t{0}; field < kWorkTableFields; ++field) {
+      work_table[field * batch_count + batch] = static_cast<int>(fields[field]);
+    }
+    num_tiles += CeilDiv(m, wgd) * CeilDiv(n, wgd);
+  }
+
+  // Copies the work table and the scalar arguments to the device upon creation of the buffers
+  const auto work_table_device = Buffer<int>(context_, work_table);
+  const auto alphas_device = Buffer<T>(context_, alphas);
+  const auto betas_device = Buffer<T>(context_, betas);
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectGroupedBatchedTT" : "XgemmDirectGroupedBatchedTN") :
+                                       (b_do_transpose ? "XgemmDirectGroupedBatchedNT" : "XgemmDirectGroupedBatchedNN");
+  auto kernel = Kernel(program_, name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(batch_count));
+  kernel.SetArgument(1, work_table_device());
+  kernel.SetArgument(2, alphas_device());
+  kernel.SetArgument(3, betas_device());
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, b_buffer());
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(8, static_cast<int>(a_conjugate));
+  kernel.SetArgument(9, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes: a single work-group in the first two dimensions and
+  // one work-group per tile in the third
+  const auto global = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], num_tiles};
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], 1};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmGroupedBatched<half>;
+template class XgemmGroupedBatched<float>;
+template class XgemmGroupedBatched<double>;
+template class XgemmGroupedBatched<float2>;
+template class XgemmGroupedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
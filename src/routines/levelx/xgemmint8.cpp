@@ -0,0 +1,140 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmInt8 class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmint8.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernel uses single precision for the scales.
+template <typename T>
+XgemmInt8<T>::XgemmInt8(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmInt8"}, Precision::kSingle, {}, {
+    #include "../../kernels/level3/xgemm_int8.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmInt8<T>::DoGemmInt8(const Layout layout,
+                              const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const QuantizedType a_type, const Buffer<cl_uchar> &a_buffer,
+                              const size_t a_offset, const size_t a_ld, const int a_zero_point,
+                              const QuantizedType b_type, const Buffer<cl_uchar> &b_buffer,
+                              const size_t b_offset, const size_t b_ld, const int b_zero_point,
+                              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                              const int c_zero_point,
+                              const float scale, const EpilogueMode scale_mode,
+                              const Buffer<float> &scale_buffer, const size_t scale_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Makes sure the zero-points of A and B can be represented by their types, such that the values
+  // minus their zero-points fit in 9 bits and the 24-bit multiplications in the kernel are exact
+  const auto valid_zero_point = [](const QuantizedType type, const int zero_point) {
+    return (type == QuantizedType::kUint8) ? (zero_point >= 0 && zero_point <= 255) :
+                                             (zero_point >= -128 && zero_point <= 127);
+  };
+  if (!valid_zero_point(a_type, a_zero_point) || !valid_zero_point(b_type, b_zero_point)) {
+    throw BLASError(StatusCode::kInvalidValue);
+  }
+
+  // Computes whether or not the matrices are transposed in memory. See GEMM routine for details.
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  static const auto a_want_rotated = false;
+  static const auto b_want_rotated = true;
+  static const auto c_want_rotated = false;
+  const auto a_do_transpose = a_rotated != a_want_rotated;
+  const auto b_do_transpose = b_rotated != b_want_rotated;
+  const auto c_do_transpose = c_rotated != c_want_rotated;
+
+  // Computes the first and second dimensions of the 3 matrices taking into account whether the
+  // matrices are rotated or not
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the matrices and the vector of per-channel scaling factors for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+  if (scale_mode != EpilogueMode::kNone) {
+    const auto scale_size = (scale_mode == EpilogueMode::kPerRow) ? m : n;
+    TestVectorX(scale_size, scale_buffer, scale_offset, 1);
+  }
+
+  // Retrieves the proper XgemmInt8 kernel from the compiled binary
+  auto kernel = Kernel(program_, "XgemmInt8");
+
+  // Sets the kernel arguments, an unused vector of scaling factors is replaced by matrix C
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(a_type == QuantizedType::kUint8));
+  kernel.SetArgument(7, a_zero_point);
+  kernel.SetArgument(8, b_buffer());
+  kernel.SetArgument(9, static_cast<int>(b_offset));
+  kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, static_cast<int>(b_type == QuantizedType::kUint8));
+  kernel.SetArgument(12, b_zero_point);
+  kernel.SetArgument(13, c_buffer());
+  kernel.SetArgument(14, static_cast<int>(c_offset));
+  kernel.SetArgument(15, static_cast<int>(c_ld));
+  kernel.SetArgument(16, c_zero_point);
+  kernel.SetArgument(17, GetRealArg(scale));
+  kernel.SetArgument(18, static_cast<int>(scale_mode));
+  kernel.SetArgument(19, (scale_mode != EpilogueMode::kNone) ? scale_buffer() : c_buffer());
+  kernel.SetArgument(20, static_cast<int>(scale_offset));
+  kernel.SetArgument(21, static_cast<int>(a_do_transpose));
+  kernel.SetArgument(22, static_cast<int>(b_do_transpose));
+  kernel.SetArgument(23, static_cast<int>(c_do_transpose));
+
+  // Computes the global and local thread sizes: one work-group per WGQ-by-WGQ tile of matrix C
+  const auto m_ceiled = Ceil(m, db_["WGQ"]);
+  const auto n_ceiled = Ceil(n, db_["WGQ"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCQ"]) / db_["WGQ"],
+    (n_ceiled * db_["NDIMCQ"]) / db_["WGQ"]
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCQ"], db_["NDIMCQ"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class: the template argument is the type of matrix C
+template class XgemmInt8<cl_char>;
+template class XgemmInt8<cl_int>;
+template class XgemmInt8<float>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,55 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmInt8 routine. This is a non-blas quantised version of GEMM:
+// matrices A and B hold signed or unsigned 8-bit integers with a zero-point each, the products are
+// accumulated in 32-bit integers, and matrix C is stored in the type of the template argument:
+// requantised to 8-bit integers (cl_char), as raw 32-bit integers (cl_int), or dequantised to
+// single precision (float). The name of the routine selects the type of matrix C in the kernel.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMINT8_H_
+#define CLBLAST_ROUTINES_XGEMMINT8_H_
+
+#include <type_traits>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmInt8: public Routine {
+ public:
+
+  // Constructor
+  XgemmInt8(Queue &queue, EventPointer event, const std::string &name =
+            std::is_same<T, float>::value ? "GEMMINT8FLOAT" :
+            std::is_same<T, cl_int>::value ? "GEMMINT8INT32" : "GEMMINT8");
+
+  // Templated-precision implementation of the routine
+  void DoGemmInt8(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                  const size_t m, const size_t n, const size_t k,
+                  const QuantizedType a_type, const Buffer<cl_uchar> &a_buffer,
+                  const size_t a_offset, const size_t a_ld, const int a_zero_point,
+                  const QuantizedType b_type, const Buffer<cl_uchar> &b_buffer,
+                  const size_t b_offset, const size_t b_ld, const int b_zero_point,
+                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                  const int c_zero_point,
+                  const float scale, const EpilogueMode scale_mode,
+                  const Buffer<float> &scale_buffer, const size_t scale_offset);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMINT8_H_
+#endif
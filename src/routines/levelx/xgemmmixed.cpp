@@ -0,0 +1,115 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMixed class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmmixed.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernel computes in single precision.
+template <typename T>
+XgemmMixed<T>::XgemmMixed(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmMixed"}, Precision::kSingle, {}, {
+    #include "../../kernels/level3/xgemm_mixed.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmMixed<T>::DoGemmMixed(const Layout layout,
+                                const Transpose a_transpose, const Transpose b_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const float alpha,
+                                const Buffer<half> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                const Buffer<half> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                const float beta,
+                                const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes whether or not the matrices are transposed in memory. See GEMM routine for details.
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  static const auto a_want_rotated = false;
+  static const auto b_want_rotated = true;
+  static const auto c_want_rotated = false;
+  const auto a_do_transpose = a_rotated != a_want_rotated;
+  const auto b_do_transpose = b_rotated != b_want_rotated;
+  const auto c_do_transpose = c_rotated != c_want_rotated;
+
+  // Computes the first and second dimensions of the 3 matrices taking into account whether the
+  // matrices are rotated or not
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the matrices for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // Retrieves the proper XgemmMixed kernel from the compiled binary
+  auto kernel = Kernel(program_, "XgemmMixed");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, b_buffer());
+  kernel.SetArgument(9, static_cast<int>(b_offset));
+  kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, static_cast<int>(c_offset));
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+  kernel.SetArgument(14, static_cast<int>(a_do_transpose));
+  kernel.SetArgument(15, static_cast<int>(b_do_transpose));
+  kernel.SetArgument(16, static_cast<int>(c_do_transpose));
+
+  // Computes the global and local thread sizes: one work-group per WGX-by-WGX tile of matrix C
+  const auto m_ceiled = Ceil(m, db_["WGX"]);
+  const auto n_ceiled = Ceil(n, db_["WGX"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCX"]) / db_["WGX"],
+    (n_ceiled * db_["NDIMCX"]) / db_["WGX"]
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCX"], db_["NDIMCX"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class: the template argument is the precision of matrix C
+template class XgemmMixed<half>;
+template class XgemmMixed<float>;
+
+// =================================================================================================
+} // namespace clblast
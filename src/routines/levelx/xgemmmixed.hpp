@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMixed routine. This is a non-blas mixed-precision version of GEMM:
+// matrices A and B are stored in half precision, the computations are performed in single
+// precision, and matrix C is stored in the precision of the template argument (half or float). The
+// kernel is compiled in single precision, so this routine does not require the 'cl_khr_fp16'
+// extension.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMMIXED_H_
+#define CLBLAST_ROUTINES_XGEMMMIXED_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmMixed: public Routine {
+ public:
+
+  // Constructor
+  XgemmMixed(Queue &queue, EventPointer event, const std::string &name =
+             (PrecisionValue<T>() == Precision::kHalf) ? "GEMMMIXEDHALF" : "GEMMMIXED");
+
+  // Templated-precision implementation of the routine
+  void DoGemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const float alpha,
+                   const Buffer<half> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<half> &b_buffer, const size_t b_offset, const size_t b_ld,
+                   const float beta,
+                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMMIXED_H_
+#endif
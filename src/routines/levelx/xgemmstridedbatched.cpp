@@ -0,0 +1,226 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmStridedBatched<T>::XgemmStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmDirectBatched","KernelSelectionSmallBatched"},
+            PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/level3.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_direct_part1.opencl"
+    #include "../../kernels/level3/xgemm_direct_part2.opencl"
+    #include "../../kernels/level3/xgemm_direct_part3.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_direct_batched.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_small_batched.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmStridedBatched<T>::DoGemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k, const T alpha,
+                                                  const Buffer<T> & a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> & b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                  const T beta,
+                                                  const Buffer<T> & c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes whether or not the matrices are transposed in memory. See GEMM routine for details.
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  static const auto a_want_rotated = false;
+  static const auto b_want_rotated = true;
+  static const auto c_want_rotated = false;
+  const auto a_do_transpose = a_rotated != a_want_rotated;
+  const auto b_do_transpose = b_rotated != b_want_rotated;
+  const auto c_do_transpose = c_rotated != c_want_rotated;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Computes the first and second dimensions of the 3 matrices taking into account whether the
+  // matrices are rotated or not
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the matrices for validity. The offsets grow with the batch index, so testing only the
+  // last batch of each matrix is equivalent to testing all batches individually.
+  TestMatrixA(a_one, a_two, a_buffer, a_offset + a_stride * (batch_count - 1), a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset + b_stride * (batch_count - 1), b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset + c_stride * (batch_count - 1), c_ld);
+
+  // Tiny matrices are computed by a kernel specialised for their size, keeping C in registers. This
+  // is disabled if either of the 'KernelSelectionSmallBatched' parameters is zero.
+  const auto small_size = (db_["XGEMM_SMALL_BATCHED_WGS"] == 0) ? 0 :
+                          SmallBatchedGemmSize(m, n, k, db_["XGEMM_SMALL_BATCHED_MAX_SIZE"]);
+  if (small_size != 0) {
+    BatchedGemmSmall(small_size, m, n, k, alpha,
+                     a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+                     beta, c_buffer, c_offset, c_ld, c_stride,
+                     a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                     batch_count);
+    return;
+  }
+
+  // Runs the single generic kernel: the offsets of each batch are computed on the device
+  BatchedGemmDirect(m, n, k, alpha,
+                    a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+                    beta, c_buffer, c_offset, c_ld, c_stride,
+                    a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                    batch_count);
+}
+
+// =================================================================================================
+
+// The direct version of strided-batched GEMM, requiring just one kernel and no uploads of offsets
+// or scalars: these are passed as kernel arguments instead.
+template <typename T>
+void XgemmStridedBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const size_t k, const T alpha,
+                                               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                               const T beta,
+                                               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                               const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                                               const bool a_conjugate, const bool b_conjugate,
+                                               const size_t batch_count) {
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectStridedBatchedTT" : "XgemmDirectStridedBatchedTN") :
+                                       (b_do_transpose ? "XgemmDirectStridedBatchedNT" : "XgemmDirectStridedBatchedNN");
+  auto kernel = Kernel(program_, name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, static_cast<int>(a_stride));
+  kernel.SetArgument(9, b_buffer());
+  kernel.SetArgument(10, static_cast<int>(b_offset));
+  kernel.SetArgument(11, static_cast<int>(b_ld));
+  kernel.SetArgument(12, static_cast<int>(b_stride));
+  kernel.SetArgument(13, c_buffer());
+  kernel.SetArgument(14, static_cast<int>(c_offset));
+  kernel.SetArgument(15, static_cast<int>(c_ld));
+  kernel.SetArgument(16, static_cast<int>(c_stride));
+  kernel.SetArgument(17, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(18, static_cast<int>(a_conjugate));
+  kernel.SetArgument(19, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes
+  const auto m_ceiled = Ceil(m, db_["WGD"]);
+  const auto n_ceiled = Ceil(n, db_["WGD"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
+    (n_ceiled * db_["NDIMCD"]) / db_["WGD"],
+    batch_count
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], 1};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The tiny-matrix version of strided-batched GEMM. Each thread computes a row of a C matrix, such
+// that a work-group processes several matrices at once.
+template <typename T>
+void XgemmStridedBatched<T>::BatchedGemmSmall(const size_t size, const size_t m, const size_t n, const size_t k, const T alpha,
+                                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                              const T beta,
+                                              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                              const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                                              const bool a_conjugate, const bool b_conjugate,
+                                              const size_t batch_count) {
+
+  // Retrieves the kernel specialised for the given size from the compiled binary
+  auto kernel = Kernel(program_, "XgemmSmallStridedBatched" + ToString(size));
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, static_cast<int>(a_stride));
+  kernel.SetArgument(9, b_buffer());
+  kernel.SetArgument(10, static_cast<int>(b_offset));
+  kernel.SetArgument(11, static_cast<int>(b_ld));
+  kernel.SetArgument(12, static_cast<int>(b_stride));
+  kernel.SetArgument(13, c_buffer());
+  kernel.SetArgument(14, static_cast<int>(c_offset));
+  kernel.SetArgument(15, static_cast<int>(c_ld));
+  kernel.SetArgument(16, static_cast<int>(c_stride));
+  kernel.SetArgument(17, static_cast<int>(a_do_transpose));
+  kernel.SetArgument(18, static_cast<int>(b_do_transpose));
+  kernel.SetArgument(19, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(20, static_cast<int>(a_conjugate));
+  kernel.SetArgument(21, static_cast<int>(b_conjugate));
+  kernel.SetArgument(22, static_cast<int>(batch_count));
+
+  // Computes the global and local thread sizes: one thread per row of each matrix
+  const auto global = std::vector<size_t>{Ceil(size * batch_count, db_["XGEMM_SMALL_BATCHED_WGS"])};
+  const auto local = std::vector<size_t>{db_["XGEMM_SMALL_BATCHED_WGS"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmStridedBatched<half>;
+template class XgemmStridedBatched<float>;
+template class XgemmStridedBatched<double>;
+template class XgemmStridedBatched<float2>;
+template class XgemmStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,123 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvbatched.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvBatched<T>::XgemvBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xgemv"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level2/xgemv.opencl"
+    #include "../../kernels/level2/xgemv_batched.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvBatched<T>::DoGemvBatched(const Layout layout, const Transpose a_transpose,
+                                    const size_t m, const size_t n,
+                                    const std::vector<T> &alphas,
+                                    const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                    const std::vector<T> &betas,
+                                    const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (alphas.size() != batch_count) || (betas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (x_offsets.size() != batch_count) || (y_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major)
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrices and vectors for validity. The required buffer size grows with the offset, so
+  // testing only the largest offset of each buffer is equivalent to testing all batches individually.
+  TestMatrixA(a_one, a_two, a_buffer, *std::max_element(a_offsets.begin(), a_offsets.end()), a_ld);
+  TestVectorX(n_real, x_buffer, *std::max_element(x_offsets.begin(), x_offsets.end()), x_inc);
+  TestVectorY(m_real, y_buffer, *std::max_element(y_offsets.begin(), y_offsets.end()), y_inc);
+
+  // Copies the arguments to the device upon creation of the buffers, avoiding a synchronisation
+  std::vector<int> a_offsets_int(a_offsets.begin(), a_offsets.end());
+  std::vector<int> x_offsets_int(x_offsets.begin(), x_offsets.end());
+  std::vector<int> y_offsets_int(y_offsets.begin(), y_offsets.end());
+  const auto a_offsets_device = Buffer<int>(context_, a_offsets_int);
+  const auto x_offsets_device = Buffer<int>(context_, x_offsets_int);
+  const auto y_offsets_device = Buffer<int>(context_, y_offsets_int);
+  const auto alphas_device = Buffer<T>(context_, alphas);
+  const auto betas_device = Buffer<T>(context_, betas);
+
+  // Retrieves the XgemvBatched kernel from the compiled binary
+  auto kernel = Kernel(program_, "XgemvBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  kernel.SetArgument(2, alphas_device());
+  kernel.SetArgument(3, betas_device());
+  kernel.SetArgument(4, static_cast<int>(a_rotated));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, a_offsets_device());
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, x_buffer());
+  kernel.SetArgument(9, x_offsets_device());
+  kernel.SetArgument(10, static_cast<int>(x_inc));
+  kernel.SetArgument(11, y_buffer());
+  kernel.SetArgument(12, y_offsets_device());
+  kernel.SetArgument(13, static_cast<int>(y_inc));
+  kernel.SetArgument(14, static_cast<int>(a_conjugate));
+
+  // Launches the kernel: one row of work-groups per batch
+  const auto m_ceiled = Ceil(m_real, db_["WGS1"]*db_["WPT1"]);
+  const auto global = std::vector<size_t>{m_ceiled / db_["WPT1"], batch_count};
+  const auto local = std::vector<size_t>{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvBatched<half>;
+template class XgemvBatched<float>;
+template class XgemvBatched<double>;
+template class XgemvBatched<float2>;
+template class XgemvBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
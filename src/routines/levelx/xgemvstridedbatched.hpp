@@ -0,0 +1,48 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvStridedBatched routine. This is a non-blas batched version of GEMV
+// in which the matrices and vectors of subsequent batches are a fixed stride apart and share alpha
+// and beta.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XGEMVSTRIDEDBATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemvStridedBatched: public Routine {
+ public:
+
+  // Constructor
+  XgemvStridedBatched(Queue &queue, EventPointer event, const std::string &name = "GEMVSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoGemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                            const size_t m, const size_t n, const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                            const T beta,
+                            const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,257 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgetrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgetrf.hpp"
+#include "routines/level1/xamax.hpp"
+#include "routines/level3/xgemm.hpp"
+#include "routines/level3/xtrsm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgetrf<T>::Xgetrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Pad"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xgetrf.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The factorisation. All kernels and sub-routines are chained through events, such that the
+// routine also works on an out-of-order queue. Only the final kernel signals the user's event.
+template <typename T>
+void Xgetrf<T>::DoGetrf(const Layout layout, const size_t m, const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+                        const Buffer<unsigned int> &info_buffer, const size_t info_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix, the pivots and the info-value for validity
+  const auto a_one = (layout == Layout::kRowMajor) ? n : m;
+  const auto a_two = (layout == Layout::kRowMajor) ? m : n;
+  const auto min_mn = std::min(m, n);
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorIndex(min_mn, ipiv_buffer, ipiv_offset);
+  TestVectorIndex(1, info_buffer, info_offset);
+
+  // The matrix is addressed by its row and column strides, such that both layouts are handled alike
+  const auto a_rs = (layout == Layout::kRowMajor) ? a_ld : size_t{1};
+  const auto a_cs = (layout == Layout::kRowMajor) ? size_t{1} : a_ld;
+  const auto index = [&](const size_t row, const size_t col) {
+    return a_offset + row * a_rs + col * a_cs;
+  };
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"] * db_["PAD_DIMY"]};
+
+  // Loops over the panels, each step waiting for the event of the step before it
+  auto amax = Xamax<T>(queue_, nullptr);
+  auto trsm = Xtrsm<T>(queue_, nullptr);
+  auto gemm = Xgemm<T>(queue_, nullptr);
+  auto eventWaitList = std::vector<Event>();
+  for (auto j = size_t{0}; j < min_mn; j += kBlockSize) {
+    const auto jb = std::min(min_mn - j, size_t{kBlockSize});
+
+    // Factorises the panel column-by-column: finds the pivot, interchanges the rows within the
+    // panel, and eliminates the column below the diagonal. The pivots are stored relative to their
+    // row until the end, as computed by AMAX.
+    for (auto k = j; k < j + jb; ++k) {
+      auto amax_event = Event();
+      amax.DoAmax(m - k, ipiv_buffer, ipiv_offset + k, a_buffer, index(k, k), a_rs,
+                  amax_event.pointer(), eventWaitList);
+
+      auto swap_kernel = Kernel(program_, "XgetrfSwap");
+      swap_kernel.SetArgument(0, static_cast<int>(k));
+      swap_kernel.SetArgument(1, static_cast<int>(j));
+      swap_kernel.SetArgument(2, static_cast<int>(jb));
+      swap_kernel.SetArgument(3, static_cast<int>(k == 0));
+      swap_kernel.SetArgument(4, ipiv_buffer());
+      swap_kernel.SetArgument(5, static_cast<int>(ipiv_offset));
+      swap_kernel.SetArgument(6, info_buffer());
+      swap_kernel.SetArgument(7, static_cast<int>(info_offset));
+      swap_kernel.SetArgument(8, a_buffer());
+      swap_kernel.SetArgument(9, static_cast<int>(a_offset));
+      swap_kernel.SetArgument(10, static_cast<int>(a_rs));
+      swap_kernel.SetArgument(11, static_cast<int>(a_cs));
+      auto swap_event = Event();
+      RunKernel(swap_kernel, queue_, device_, GlobalSize(jb), local, swap_event.pointer(),
+                std::vector<Event>{amax_event});
+      eventWaitList = std::vector<Event>{swap_event};
+
+      if (k + 1 < m) {
+        auto scale_kernel = Kernel(program_, "XgetrfScale");
+        scale_kernel.SetArgument(0, static_cast<int>(m));
+        scale_kernel.SetArgument(1, static_cast<int>(k));
+        scale_kernel.SetArgument(2, static_cast<int>(j + jb));
+        scale_kernel.SetArgument(3, a_buffer());
+        scale_kernel.SetArgument(4, static_cast<int>(a_offset));
+        scale_kernel.SetArgument(5, static_cast<int>(a_rs));
+        scale_kernel.SetArgument(6, static_cast<int>(a_cs));
+        auto scale_event = Event();
+        RunKernel(scale_kernel, queue_, device_, GlobalSize(m - k - 1), local,
+                  scale_event.pointer(), eventWaitList);
+        eventWaitList = std::vector<Event>{scale_event};
+      }
+    }
+
+    // Applies the row interchanges of the panel to the columns left and right of it
+    if (jb < n) {
+      auto pivot_event = Event();
+      ApplyPivots(pivot_event.pointer(), eventWaitList, n, j, j + jb, j, j + jb, true, true,
+                  ipiv_buffer, ipiv_offset, a_buffer, a_offset, a_rs, a_cs);
+      eventWaitList = std::vector<Event>{pivot_event};
+    }
+
+    // Solves the block row to the right of the panel and updates the trailing matrix
+    if (j + jb < n) {
+      const auto n2 = n - j - jb;
+      auto trsm_event = Event();
+      trsm.DoTrsm(layout, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kUnit,
+                  jb, n2, ConstantOne<T>(),
+                  a_buffer, index(j, j), a_ld,
+                  a_buffer, index(j, j + jb), a_ld,
+                  trsm_event.pointer(), eventWaitList);
+      eventWaitList = std::vector<Event>{trsm_event};
+      if (j + jb < m) {
+        auto gemm_event = Event();
+        gemm.DoGemm(layout, Transpose::kNo, Transpose::kNo, m - j - jb, n2, jb,
+                    ConstantNegOne<T>(),
+                    a_buffer, index(j + jb, j), a_ld,
+                    a_buffer, index(j, j + jb), a_ld,
+                    ConstantOne<T>(),
+                    a_buffer, index(j + jb, j + jb), a_ld,
+                    gemm_event.pointer(), eventWaitList);
+        eventWaitList = std::vector<Event>{gemm_event};
+      }
+    }
+  }
+
+  // Converts the pivots into absolute row indices
+  auto kernel = Kernel(program_, "XgetrfPivotOffsets");
+  kernel.SetArgument(0, static_cast<int>(min_mn));
+  kernel.SetArgument(1, ipiv_buffer());
+  kernel.SetArgument(2, static_cast<int>(ipiv_offset));
+  RunKernel(kernel, queue_, device_, GlobalSize(min_mn), local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// The solver: computes X := op(A)^-1 * B in-place using the factorisation computed by DoGetrf
+template <typename T>
+void Xgetrf<T>::DoGetrs(const Layout layout, const Transpose a_transpose,
+                        const size_t n, const size_t nrhs,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+                        const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((n == 0) || (nrhs == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices and the pivots for validity
+  const auto b_one = (layout == Layout::kRowMajor) ? nrhs : n;
+  const auto b_two = (layout == Layout::kRowMajor) ? n : nrhs;
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestVectorIndex(n, ipiv_buffer, ipiv_offset);
+  const auto b_rs = (layout == Layout::kRowMajor) ? b_ld : size_t{1};
+  const auto b_cs = (layout == Layout::kRowMajor) ? size_t{1} : b_ld;
+
+  // The three steps are chained through events, only the last one signals the user's event
+  auto trsm = Xtrsm<T>(queue_, nullptr);
+  auto first_event = Event();
+  auto second_event = Event();
+
+  // Solves P * L * U * X = B: the row interchanges are applied before the triangular solves
+  if (a_transpose == Transpose::kNo) {
+    ApplyPivots(first_event.pointer(), std::vector<Event>(), nrhs, 0, 0, 0, n, true, false,
+                ipiv_buffer, ipiv_offset, b_buffer, b_offset, b_rs, b_cs);
+    trsm.DoTrsm(layout, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kUnit,
+                n, nrhs, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld,
+                b_buffer, b_offset, b_ld,
+                second_event.pointer(), std::vector<Event>{first_event});
+    trsm.DoTrsm(layout, Side::kLeft, Triangle::kUpper, Transpose::kNo, Diagonal::kNonUnit,
+                n, nrhs, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld,
+                b_buffer, b_offset, b_ld,
+                event_, std::vector<Event>{second_event});
+  }
+
+  // Solves (P * L * U)^T * X = B: the row interchanges are applied in reverse order afterwards
+  else {
+    trsm.DoTrsm(layout, Side::kLeft, Triangle::kUpper, a_transpose, Diagonal::kNonUnit,
+                n, nrhs, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld,
+                b_buffer, b_offset, b_ld,
+                first_event.pointer(), std::vector<Event>());
+    trsm.DoTrsm(layout, Side::kLeft, Triangle::kLower, a_transpose, Diagonal::kUnit,
+                n, nrhs, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld,
+                b_buffer, b_offset, b_ld,
+                second_event.pointer(), std::vector<Event>{first_event});
+    ApplyPivots(event_, std::vector<Event>{second_event}, nrhs, 0, 0, 0, n, false, false,
+                ipiv_buffer, ipiv_offset, b_buffer, b_offset, b_rs, b_cs);
+  }
+}
+
+// =================================================================================================
+
+// Applies row interchanges, one thread per column
+template <typename T>
+void Xgetrf<T>::ApplyPivots(EventPointer event, const std::vector<Event> &waitForEvents,
+                            const size_t num_columns,
+                            const size_t skip_start, const size_t skip_end,
+                            const size_t k_start, const size_t k_end,
+                            const bool forward, const bool relative,
+                            const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+                            const Buffer<T> &buffer, const size_t offset,
+                            const size_t row_stride, const size_t col_stride) {
+  auto kernel = Kernel(program_, "XgetrfApplyPivots");
+  kernel.SetArgument(0, static_cast<int>(num_columns));
+  kernel.SetArgument(1, static_cast<int>(skip_start));
+  kernel.SetArgument(2, static_cast<int>(skip_end));
+  kernel.SetArgument(3, static_cast<int>(k_start));
+  kernel.SetArgument(4, static_cast<int>(k_end));
+  kernel.SetArgument(5, static_cast<int>(forward));
+  kernel.SetArgument(6, static_cast<int>(relative));
+  kernel.SetArgument(7, ipiv_buffer());
+  kernel.SetArgument(8, static_cast<int>(ipiv_offset));
+  kernel.SetArgument(9, buffer());
+  kernel.SetArgument(10, static_cast<int>(offset));
+  kernel.SetArgument(11, static_cast<int>(row_stride));
+  kernel.SetArgument(12, static_cast<int>(col_stride));
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"] * db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, GlobalSize(num_columns), local, event, waitForEvents);
+}
+
+// The one-dimensional kernels use as many threads per work-group as the 'Pad' kernels
+template <typename T>
+std::vector<size_t> Xgetrf<T>::GlobalSize(const size_t size) const {
+  return std::vector<size_t>{Ceil(size, db_["PAD_DIMX"] * db_["PAD_DIMY"])};
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgetrf<float>;
+template class Xgetrf<double>;
+template class Xgetrf<float2>;
+template class Xgetrf<double2>;
+
+// =================================================================================================
+} // namespace clblast
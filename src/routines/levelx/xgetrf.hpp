@@ -0,0 +1,68 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgetrf routine. This is a non-blas routine for the blocked right-looking
+// LU factorisation with partial pivoting of a general matrix, as in LAPACK's GETRF. Each panel is
+// factorised column-by-column by small kernels with the pivots found by AMAX, after which the row
+// interchanges are applied to the rest of the matrix, the block row is solved by TRSM and the
+// trailing matrix is updated by GEMM. The class also implements the matching solver (GETRS). The
+// pivots are stored as 0-based row indices.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGETRF_H_
+#define CLBLAST_ROUTINES_XGETRF_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgetrf: public Routine {
+ public:
+
+  // Constructor
+  Xgetrf(Queue &queue, EventPointer event, const std::string &name = "GETRF");
+
+  // Templated-precision implementation of the routines
+  void DoGetrf(const Layout layout, const size_t m, const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+               const Buffer<unsigned int> &info_buffer, const size_t info_offset);
+  void DoGetrs(const Layout layout, const Transpose a_transpose, const size_t n, const size_t nrhs,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // The width of the panels
+  static constexpr size_t kBlockSize = 64;
+
+  // Applies the row interchanges of pivots [k_start, k_end) to all columns of a matrix except for
+  // the columns [skip_start, skip_end), see 'xgetrf.opencl'
+  void ApplyPivots(EventPointer event, const std::vector<Event> &waitForEvents,
+                   const size_t num_columns,
+                   const size_t skip_start, const size_t skip_end,
+                   const size_t k_start, const size_t k_end,
+                   const bool forward, const bool relative,
+                   const Buffer<unsigned int> &ipiv_buffer, const size_t ipiv_offset,
+                   const Buffer<T> &buffer, const size_t offset,
+                   const size_t row_stride, const size_t col_stride);
+
+  // Returns the global size of a one-dimensional kernel with 'size' threads
+  std::vector<size_t> GlobalSize(const size_t size) const;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGETRF_H_
+#endif
@@ -29,6 +29,8 @@ Xinvert<T>::Xinvert(Queue &queue, EventPointer event, const std::string &name):
     Routine(queue, event, name, {"Invert"}, PrecisionValue<T>(), {}, {
     #include "../../kernels/level3/level3.opencl"
     #include "../../kernels/level3/invert_diagonal_blocks.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/invert_diagonal_blocks_batched.opencl"
     }) {
 }
 
@@ -40,6 +42,16 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
                                             const size_t n, const size_t block_size,
                                             const Buffer<T> &src, const size_t offset, const size_t ld_src,
                                             Buffer<T> &dest) {
+  InvertMatrixDiagonalBlocks(layout, triangle, diag, n, block_size, src, offset, ld_src, dest,
+                             std::vector<Event>());
+}
+
+// As above, but with a list of events to wait for before starting
+template <typename T>
+void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle triangle, const Diagonal diag,
+                                            const size_t n, const size_t block_size,
+                                            const Buffer<T> &src, const size_t offset, const size_t ld_src,
+                                            Buffer<T> &dest, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if ((block_size == 0) || (n == 0)) {
@@ -56,7 +68,7 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
   // This routine only supports block sizes which are a multiple of the internal block size and
   // block sizes up to and including 128
   if ((block_size % internal_block_size != 0) || (block_size > 128)) {
-    throw BLASError(StatusCode::kUnknownError);
+    throw BLASError(StatusCode::kInvalidLocalThreadsTotal, "block size");
   }
 
   // Checks for validity of the source and destination matrices
@@ -69,10 +81,10 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
                          (triangle == Triangle::kLower && layout == Layout::kRowMajor));
   const auto name_postfix = (is_upper) ? "Upper" : "Lower";
 
-  // Fills the output buffer with zeros
-  auto event_wait_list = std::vector<Event>();
+  // Fills the output buffer with zeros. The inversion kernels wait for the given events as well.
+  auto event_wait_list = waitForEvents;
   auto fill_matrix_event = Event();
-  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), event_wait_list,
+  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), std::vector<Event>(),
              block_size, num_blocks * block_size, block_size, 0, dest, ConstantZero<T>());
   event_wait_list.push_back(fill_matrix_event);
 
@@ -140,6 +152,121 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
 
 // =================================================================================================
 
+// Batched version of the above: the source matrices are not checked here, this is left to the
+// caller which also knows the offsets on the host. Each kernel processes all batches at once.
+template <typename T>
+void Xinvert<T>::InvertMatrixDiagonalBlocksBatched(const Layout layout, const Triangle triangle,
+                                                   const Diagonal diag, const size_t n,
+                                                   const size_t block_size,
+                                                   const Buffer<T> &src, const Buffer<int> &src_offsets,
+                                                   const size_t ld_src,
+                                                   Buffer<T> &dest, const size_t dest_stride,
+                                                   const size_t batch_count) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((block_size == 0) || (n == 0) || (batch_count == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Helper variables
+  const auto internal_block_size = static_cast<size_t>(db_["INTERNAL_BLOCK_SIZE"]);
+  assert(internal_block_size == 16);
+  const auto num_blocks = CeilDiv(n, block_size);
+  const auto num_internal_blocks = CeilDiv(n, internal_block_size);
+  const auto unit_diagonal = (diag == Diagonal::kUnit) ? true : false;
+
+  // Same restrictions on the block size as the non-batched version
+  if ((block_size % internal_block_size != 0) || (block_size > 128)) {
+    throw BLASError(StatusCode::kInvalidLocalThreadsTotal, "block size");
+  }
+
+  // Checks for validity of the destination matrices
+  if (dest_stride < num_blocks * block_size * block_size) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+  TestMatrixB(block_size, dest_stride * batch_count / block_size, dest, 0, block_size);
+
+  // Determines which kernels to run, see the non-batched version
+  const bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto name_postfix = std::string{(is_upper) ? "Upper" : "Lower"};
+
+  // Fills the output buffers of all batches with zeros at once
+  auto event_wait_list = std::vector<Event>();
+  auto fill_matrix_event = Event();
+  FillMatrix(queue_, device_, program_, db_, fill_matrix_event.pointer(), event_wait_list,
+             block_size, dest_stride * batch_count / block_size, block_size, 0, dest,
+             ConstantZero<T>());
+  event_wait_list.push_back(fill_matrix_event);
+
+  // Inverts the diagonal IB by IB inner blocks of all matrices: the batch is the second dimension
+  const auto is_last_base_kernel = (internal_block_size >= block_size) || (internal_block_size >= n);
+  auto kernel = Kernel(program_, "InvertDiagonalBlockBatched");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, src());
+  kernel.SetArgument(2, src_offsets());
+  kernel.SetArgument(3, static_cast<int>(ld_src));
+  kernel.SetArgument(4, dest());
+  kernel.SetArgument(5, static_cast<int>(dest_stride));
+  kernel.SetArgument(6, static_cast<int>(block_size));
+  kernel.SetArgument(7, static_cast<int>(unit_diagonal));
+  kernel.SetArgument(8, static_cast<int>(is_upper));
+  const auto local = std::vector<size_t>{internal_block_size, 1};
+  const auto global = std::vector<size_t>{num_internal_blocks * internal_block_size, batch_count};
+  auto base_kernel_event = Event();
+  auto base_kernel_event_pointer = (is_last_base_kernel) ? event_ : base_kernel_event.pointer();
+  RunKernel(kernel, queue_, device_, global, local, base_kernel_event_pointer, event_wait_list);
+  if (is_last_base_kernel) { return; }
+  event_wait_list.push_back(base_kernel_event);
+
+  // Builds up block_size x block_size blocks as in the non-batched version, the batch is the third
+  // dimension of the grid
+  for (auto current_size = internal_block_size; current_size < block_size; current_size *= 2) {
+    assert(current_size == 16 || current_size == 32 || current_size == 64);
+    const bool is_last_kernel = (current_size * 2 >= block_size) || (current_size * 2 >= n);
+
+    // Emulates a 3D grid: NX * (NY * npages) * batch_count
+    const auto npages = CeilDiv(n, current_size*2);
+    const auto local0 = (current_size <= 32) ? current_size/4 : 16;
+    const auto local = std::vector<size_t>{local0, 4, 1};
+    const auto global = std::vector<size_t>{(current_size/local[1]),
+                                            npages*(current_size/16)*local[1], batch_count};
+
+    // Part 1
+    auto kernel1 = Kernel(program_, "TripleMatMul" + ToString(current_size) + "Part1" +
+                                    name_postfix + "Batched");
+    kernel1.SetArgument(0, static_cast<int>(n));
+    kernel1.SetArgument(1, src());
+    kernel1.SetArgument(2, src_offsets());
+    kernel1.SetArgument(3, static_cast<int>(ld_src));
+    kernel1.SetArgument(4, dest());
+    kernel1.SetArgument(5, static_cast<int>(dest_stride));
+    kernel1.SetArgument(6, static_cast<int>(current_size));
+    kernel1.SetArgument(7, static_cast<int>(npages));
+    kernel1.SetArgument(8, static_cast<int>(block_size));
+    auto kernel1_event = Event();
+    RunKernel(kernel1, queue_, device_, global, local, kernel1_event.pointer(), event_wait_list);
+    event_wait_list.push_back(kernel1_event);
+
+    // Part 2
+    auto kernel2 = Kernel(program_, "TripleMatMul" + ToString(current_size) + "Part2" +
+                                    name_postfix + "Batched");
+    kernel2.SetArgument(0, static_cast<int>(n));
+    kernel2.SetArgument(1, dest());
+    kernel2.SetArgument(2, static_cast<int>(dest_stride));
+    kernel2.SetArgument(3, static_cast<int>(current_size));
+    kernel2.SetArgument(4, static_cast<int>(npages));
+    kernel2.SetArgument(5, static_cast<int>(block_size));
+    auto kernel2_event = Event();
+    auto kernel2_event_pointer = (is_last_kernel) ? event_ : kernel2_event.pointer();
+    RunKernel(kernel2, queue_, device_, global, local, kernel2_event_pointer, event_wait_list);
+    if (is_last_kernel) { break; }
+    event_wait_list.push_back(kernel2_event);
+  }
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xinvert<half>;
 template class Xinvert<float>;
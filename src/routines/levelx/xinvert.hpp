@@ -31,6 +31,20 @@ class Xinvert: public Routine {
                                   const size_t n, const size_t block_size,
                                   const Buffer<T> &src, const size_t offset, const size_t ld_src,
                                   Buffer<T> &dest);
+  // As above, but with a list of events to wait for before starting
+  void InvertMatrixDiagonalBlocks(const Layout layout, const Triangle triangle, const Diagonal diag,
+                                  const size_t n, const size_t block_size,
+                                  const Buffer<T> &src, const size_t offset, const size_t ld_src,
+                                  Buffer<T> &dest, const std::vector<Event> &waitForEvents);
+
+  // As above, but for a batch of matrices given by an array of offsets in device memory. The
+  // inverted blocks of subsequent matrices are stored 'dest_stride' elements apart.
+  void InvertMatrixDiagonalBlocksBatched(const Layout layout, const Triangle triangle,
+                                         const Diagonal diag, const size_t n, const size_t block_size,
+                                         const Buffer<T> &src, const Buffer<int> &src_offsets,
+                                         const size_t ld_src,
+                                         Buffer<T> &dest, const size_t dest_stride,
+                                         const size_t batch_count);
 };
 
 // =================================================================================================
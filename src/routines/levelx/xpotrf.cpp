@@ -0,0 +1,197 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpotrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xpotrf.hpp"
+#include "routines/level3/xtrsm.hpp"
+#include "routines/level3/xsyrk.hpp"
+#include "routines/level3/xherk.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xpotrf<T>::Xpotrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Pad"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xpotrf.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The factorisation. All kernels and sub-routines are chained through events, such that the
+// routine also works on an out-of-order queue. Only the last panel kernel signals the user's event.
+template <typename T>
+void Xpotrf<T>::DoPotrf(const Layout layout, const Triangle triangle, const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<unsigned int> &info_buffer, const size_t info_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the info-value for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestVectorIndex(1, info_buffer, info_offset);
+
+  // The matrix is addressed by its row and column strides, such that both layouts are handled alike
+  const auto a_rs = (layout == Layout::kRowMajor) ? a_ld : size_t{1};
+  const auto a_cs = (layout == Layout::kRowMajor) ? size_t{1} : a_ld;
+  const auto index = [&](const size_t row, const size_t col) {
+    return a_offset + row * a_rs + col * a_cs;
+  };
+
+  // The panel kernel runs as a single work-group. It factorises a lower triangle, an upper triangle
+  // is passed as its conjugate-transpose by swapping the strides.
+  const auto is_lower = (triangle == Triangle::kLower);
+  const auto panel_threads = db_["PAD_DIMX"] * db_["PAD_DIMY"];
+
+  // Loops over the diagonal blocks, each step waiting for the event(s) of the step before it
+  auto trsm = Xtrsm<T>(queue_, nullptr);
+  auto eventWaitList = std::vector<Event>();
+  for (auto j = size_t{0}; j < n; j += kBlockSize) {
+    const auto jb = std::min(n - j, size_t{kBlockSize});
+    const auto is_last = (j + jb == n);
+
+    // Factorises the diagonal block
+    auto kernel = Kernel(program_, "XpotrfPanel");
+    kernel.SetArgument(0, static_cast<int>(jb));
+    kernel.SetArgument(1, static_cast<int>(j));
+    kernel.SetArgument(2, static_cast<int>(j == 0));
+    kernel.SetArgument(3, info_buffer());
+    kernel.SetArgument(4, static_cast<int>(info_offset));
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, static_cast<int>(index(j, j)));
+    kernel.SetArgument(7, static_cast<int>((is_lower) ? a_rs : a_cs));
+    kernel.SetArgument(8, static_cast<int>((is_lower) ? a_cs : a_rs));
+    kernel.SetArgument(9, static_cast<int>(!is_lower));
+    const auto global = std::vector<size_t>{panel_threads};
+    const auto local = std::vector<size_t>{panel_threads};
+    if (is_last) {
+      RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+      break;
+    }
+    auto panel_event = Event();
+    RunKernel(kernel, queue_, device_, global, local, panel_event.pointer(), eventWaitList);
+
+    // Solves the off-diagonal blocks and updates the trailing matrix
+    const auto n2 = n - j - jb;
+    auto trsm_event = Event();
+    auto update_event = Event();
+    if (is_lower) {
+      trsm.DoTrsm(layout, Side::kRight, Triangle::kLower, Transpose::kConjugate, Diagonal::kNonUnit,
+                  n2, jb, ConstantOne<T>(),
+                  a_buffer, index(j, j), a_ld,
+                  a_buffer, index(j + jb, j), a_ld,
+                  trsm_event.pointer(), std::vector<Event>{panel_event});
+      RankUpdate(layout, Triangle::kLower, Transpose::kNo, n2, jb,
+                 a_buffer, index(j + jb, j), a_ld,
+                 a_buffer, index(j + jb, j + jb), a_ld,
+                 update_event.pointer(), std::vector<Event>{trsm_event});
+    }
+    else {
+      trsm.DoTrsm(layout, Side::kLeft, Triangle::kUpper, Transpose::kConjugate, Diagonal::kNonUnit,
+                  jb, n2, ConstantOne<T>(),
+                  a_buffer, index(j, j), a_ld,
+                  a_buffer, index(j, j + jb), a_ld,
+                  trsm_event.pointer(), std::vector<Event>{panel_event});
+      RankUpdate(layout, Triangle::kUpper, Transpose::kConjugate, n2, jb,
+                 a_buffer, index(j, j + jb), a_ld,
+                 a_buffer, index(j + jb, j + jb), a_ld,
+                 update_event.pointer(), std::vector<Event>{trsm_event});
+    }
+    eventWaitList = std::vector<Event>{update_event};
+  }
+}
+
+// =================================================================================================
+
+// The solver: computes X := A^-1 * B in-place using the factorisation computed by DoPotrf
+template <typename T>
+void Xpotrf<T>::DoPotrs(const Layout layout, const Triangle triangle,
+                        const size_t n, const size_t nrhs,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((n == 0) || (nrhs == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Solves L * L^H * X = B or U^H * U * X = B as two triangular systems
+  const auto is_lower = (triangle == Triangle::kLower);
+  const auto first_transpose = (is_lower) ? Transpose::kNo : Transpose::kConjugate;
+  const auto second_transpose = (is_lower) ? Transpose::kConjugate : Transpose::kNo;
+  auto trsm = Xtrsm<T>(queue_, nullptr);
+  auto first_event = Event();
+  trsm.DoTrsm(layout, Side::kLeft, triangle, first_transpose, Diagonal::kNonUnit,
+              n, nrhs, ConstantOne<T>(),
+              a_buffer, a_offset, a_ld,
+              b_buffer, b_offset, b_ld,
+              first_event.pointer(), std::vector<Event>());
+  trsm.DoTrsm(layout, Side::kLeft, triangle, second_transpose, Diagonal::kNonUnit,
+              n, nrhs, ConstantOne<T>(),
+              a_buffer, a_offset, a_ld,
+              b_buffer, b_offset, b_ld,
+              event_, std::vector<Event>{first_event});
+}
+
+// =================================================================================================
+
+// The rank-k update of the trailing matrix: SYRK for real data-types and HERK for complex ones
+template <typename T>
+void Xpotrf<T>::RankUpdate(const Layout layout, const Triangle triangle,
+                           const Transpose a_transpose, const size_t n, const size_t k,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                           EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto syrk = Xsyrk<T>(queue_, nullptr);
+  syrk.DoSyrk(layout, triangle, a_transpose, n, k,
+              ConstantNegOne<T>(), a_buffer, a_offset, a_ld,
+              ConstantOne<T>(), c_buffer, c_offset, c_ld, event, waitForEvents);
+}
+template <>
+void Xpotrf<float2>::RankUpdate(const Layout layout, const Triangle triangle,
+                                const Transpose a_transpose, const size_t n, const size_t k,
+                                const Buffer<float2> &a_buffer, const size_t a_offset,
+                                const size_t a_ld, const Buffer<float2> &c_buffer,
+                                const size_t c_offset, const size_t c_ld,
+                                EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto herk = Xherk<float2,float>(queue_, nullptr);
+  herk.DoHerk(layout, triangle, a_transpose, n, k,
+              -1.0f, a_buffer, a_offset, a_ld,
+              1.0f, c_buffer, c_offset, c_ld, event, waitForEvents);
+}
+template <>
+void Xpotrf<double2>::RankUpdate(const Layout layout, const Triangle triangle,
+                                 const Transpose a_transpose, const size_t n, const size_t k,
+                                 const Buffer<double2> &a_buffer, const size_t a_offset,
+                                 const size_t a_ld, const Buffer<double2> &c_buffer,
+                                 const size_t c_offset, const size_t c_ld,
+                                 EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto herk = Xherk<double2,double>(queue_, nullptr);
+  herk.DoHerk(layout, triangle, a_transpose, n, k,
+              -1.0, a_buffer, a_offset, a_ld,
+              1.0, c_buffer, c_offset, c_ld, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xpotrf<float>;
+template class Xpotrf<double>;
+template class Xpotrf<float2>;
+template class Xpotrf<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpotrf routine. This is a non-blas routine for the blocked right-looking
+// Cholesky factorisation of a symmetric (Hermitian) positive-definite matrix, as in LAPACK's POTRF.
+// The diagonal blocks are factorised by a small panel kernel, after which the blocks below (or to
+// the right of) them are solved by TRSM and the trailing matrix is updated by SYRK (or HERK). The
+// class also implements the matching solver (POTRS) based on two triangular solves.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XPOTRF_H_
+#define CLBLAST_ROUTINES_XPOTRF_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xpotrf: public Routine {
+ public:
+
+  // Constructor
+  Xpotrf(Queue &queue, EventPointer event, const std::string &name = "POTRF");
+
+  // Templated-precision implementation of the routines
+  void DoPotrf(const Layout layout, const Triangle triangle, const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<unsigned int> &info_buffer, const size_t info_offset);
+  void DoPotrs(const Layout layout, const Triangle triangle, const size_t n, const size_t nrhs,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // The width of the panels, i.e. the size of the diagonal blocks
+  static constexpr size_t kBlockSize = 64;
+
+  // Computes C := C - A * A^H or C := C - A^H * A, by SYRK for real or by HERK for complex data
+  void RankUpdate(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                  const size_t n, const size_t k,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                  EventPointer event, const std::vector<Event> &waitForEvents);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XPOTRF_H_
+#endif
@@ -0,0 +1,161 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsmBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrsmbatched.hpp"
+#include "routines/levelx/xinvert.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrsmBatched<T>::XtrsmBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xtrsv", "Invert"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level2/xtrsv_batched.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XtrsmBatched<T>::DoTrsmBatched(const Layout layout, Side side, Triangle triangle,
+                                    const Transpose a_transpose, const Diagonal diagonal,
+                                    size_t m, size_t n,
+                                    const std::vector<T> &alphas,
+                                    const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                    const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (alphas.size() != batch_count) ||
+      (a_offsets.size() != batch_count) || (b_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Converts row-major to a col-major problem, see the regular TRSM routine for details
+  if (layout == Layout::kRowMajor) {
+    std::swap(m, n);
+    side = (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+    triangle = (triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower;
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Settings: as for the regular TRSM routine, the block size is a multiple of the internal block
+  // size of the inversion kernels. It determines the work-group size of the kernels, so an invalid
+  // value is reported as such.
+  const auto block_size = static_cast<size_t>(db_["TRSM_BLOCK_SIZE"]);
+  if ((block_size < 16) || (block_size > 128) || ((block_size & (block_size - 1)) != 0)) {
+    throw BLASError(StatusCode::kInvalidLocalThreadsTotal, "TRSM_BLOCK_SIZE");
+  }
+
+  // Computes the k dimension, the size of the triangular A matrix
+  const auto k = (side == Side::kLeft) ? m : n;
+
+  // Tests the matrices for validity. The required buffer size grows with the offset, so testing
+  // only the largest offset of each buffer is equivalent to testing all batches individually.
+  TestMatrixA(k, k, a_buffer, *std::max_element(a_offsets.begin(), a_offsets.end()), a_ld);
+  TestMatrixB(m, n, b_buffer, *std::max_element(b_offsets.begin(), b_offsets.end()), b_ld);
+
+  // Solves for the columns of B (left side) or for the rows of B (right side)
+  if (side == Side::kLeft) {
+    BatchedSolve(side, triangle, a_transpose, diagonal, m, n, block_size, alphas,
+                 a_buffer, a_offsets, a_ld, b_buffer, b_offsets, 1, b_ld, batch_count);
+  }
+  else {
+    BatchedSolve(side, triangle, a_transpose, diagonal, n, m, block_size, alphas,
+                 a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, 1, batch_count);
+  }
+}
+
+// =================================================================================================
+
+// Inverts the diagonal blocks of all A matrices and then runs the solver kernel. The right side
+// case X * op(A) = B is solved as op(A)^T * X^T = B^T, i.e. with the opposite transpose.
+template <typename T>
+void XtrsmBatched<T>::BatchedSolve(const Side side, const Triangle triangle,
+                                   const Transpose a_transpose, const Diagonal diagonal,
+                                   const size_t n, const size_t num_rhs, const size_t block_size,
+                                   const std::vector<T> &alphas,
+                                   const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                   const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets,
+                                   const size_t b_inc, const size_t b_rhs_stride,
+                                   const size_t batch_count) {
+
+  // Derives properties based on the arguments ('^' is the XOR operator)
+  const auto is_right = (side == Side::kRight);
+  const auto is_transposed = (a_transpose != Transpose::kNo) ^ is_right;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto is_forward = (triangle == Triangle::kLower) ^ (a_transpose != Transpose::kNo) ^ is_right;
+
+  // Copies the arguments to the device upon creation of the buffers, avoiding a synchronisation
+  std::vector<int> a_offsets_int(a_offsets.begin(), a_offsets.end());
+  std::vector<int> b_offsets_int(b_offsets.begin(), b_offsets.end());
+  const auto a_offsets_device = Buffer<int>(context_, a_offsets_int);
+  const auto b_offsets_device = Buffer<int>(context_, b_offsets_int);
+  const auto alphas_device = Buffer<T>(context_, alphas);
+
+  // Temporary buffer for the inverted block_size x block_size diagonal blocks of all the A matrices
+  const auto a_inv_stride = Ceil(n, block_size) * block_size * block_size;
+  auto a_inv_buffer = Buffer<T>(context_, a_inv_stride * batch_count);
+
+  // Inverts the diagonal blocks of all the A matrices at once
+  auto diagonal_invert_event = Event();
+  auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
+  inverter.InvertMatrixDiagonalBlocksBatched(Layout::kColMajor, triangle, diagonal,
+                                             n, block_size, a_buffer, a_offsets_device, a_ld,
+                                             a_inv_buffer, a_inv_stride, batch_count);
+  auto eventWaitList = std::vector<Event>{diagonal_invert_event};
+
+  // Retrieves the TrsvBatched kernel from the compiled binary
+  auto kernel = Kernel(program_, "TrsvBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, alphas_device());
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, a_offsets_device());
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, a_inv_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_inv_stride));
+  kernel.SetArgument(7, b_buffer());
+  kernel.SetArgument(8, b_offsets_device());
+  kernel.SetArgument(9, static_cast<int>(b_inc));
+  kernel.SetArgument(10, static_cast<int>(b_rhs_stride));
+  kernel.SetArgument(11, static_cast<int>(is_transposed));
+  kernel.SetArgument(12, static_cast<int>(do_conjugate));
+  kernel.SetArgument(13, static_cast<int>(is_forward));
+
+  // Launches the kernel: one work-group per right-hand side and per batch
+  const auto global = std::vector<size_t>{block_size * num_rhs, batch_count};
+  const auto local = std::vector<size_t>{block_size, 1};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrsmBatched<half>;
+template class XtrsmBatched<float>;
+template class XtrsmBatched<double>;
+template class XtrsmBatched<float2>;
+template class XtrsmBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,63 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsmBatched routine. This is a non-blas batched version of TRSM. The
+// diagonal blocks of all triangular matrices are inverted together, after which a single kernel
+// solves all systems: the number of kernel launches does not depend on the batch count.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSMBATCHED_H_
+#define CLBLAST_ROUTINES_XTRSMBATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XtrsmBatched: public Routine {
+ public:
+
+  // Constructor
+  XtrsmBatched(Queue &queue, EventPointer event, const std::string &name = "TRSMBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoTrsmBatched(const Layout layout, Side side, Triangle triangle,
+                     const Transpose a_transpose, const Diagonal diagonal,
+                     size_t m, size_t n,
+                     const std::vector<T> &alphas,
+                     const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                     const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets, const size_t b_ld,
+                     const size_t batch_count);
+
+ protected:
+
+  // Solves a batch of col-major triangular systems of size 'n' for 'num_rhs' right-hand sides in
+  // 'b', which are 'b_rhs_stride' elements apart. The buffers are assumed to be tested already. The
+  // diagonal blocks are inverted with the given block size, which has to match the block size the
+  // solver kernel is compiled with (TRSM_BLOCK_SIZE for TRSM and TRSV_BLOCK_SIZE for TRSV).
+  void BatchedSolve(const Side side, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t n, const size_t num_rhs, const size_t block_size,
+                    const std::vector<T> &alphas,
+                    const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                    const Buffer<T> &b_buffer, const std::vector<size_t> &b_offsets,
+                    const size_t b_inc, const size_t b_rhs_stride,
+                    const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSMBATCHED_H_
+#endif
@@ -0,0 +1,50 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsmStridedBatched routine. This is a non-blas batched version of TRSM
+// with a fixed stride between the matrices of subsequent batches.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSMSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XTRSMSTRIDEDBATCHED_H_
+
+#include <vector>
+
+#include "routines/levelx/xtrsmbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XtrsmStridedBatched: public XtrsmBatched<T> {
+ public:
+
+  // Uses methods of the XtrsmBatched routine
+  using XtrsmBatched<T>::DoTrsmBatched;
+
+  // Constructor
+  XtrsmStridedBatched(Queue &queue, EventPointer event, const std::string &name = "TRSMSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoTrsmStridedBatched(const Layout layout, const Side side, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t m, const size_t n,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSMSTRIDEDBATCHED_H_
+#endif
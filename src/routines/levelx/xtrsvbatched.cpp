@@ -0,0 +1,80 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsvBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrsvbatched.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrsvBatched<T>::XtrsvBatched(Queue &queue, EventPointer event, const std::string &name):
+    XtrsmBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XtrsvBatched<T>::DoTrsvBatched(const Layout layout, const Triangle triangle,
+                                    const Transpose a_transpose, const Diagonal diagonal,
+                                    const size_t n,
+                                    const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (a_offsets.size() != batch_count) || (x_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices and vectors for validity, see the batched GEMV routine
+  TestMatrixA(n, n, a_buffer, *std::max_element(a_offsets.begin(), a_offsets.end()), a_ld);
+  TestVectorX(n, x_buffer, *std::max_element(x_offsets.begin(), x_offsets.end()), x_inc);
+
+  // A row-major matrix is the transpose of a col-major matrix with the opposite triangle: this is
+  // solved as x^T * op(A)^T = b^T, in the same way as the right side case of TRSM
+  const auto side = (layout == Layout::kRowMajor) ? Side::kRight : Side::kLeft;
+  const auto col_major_triangle = (layout == Layout::kRowMajor) ?
+                                  ((triangle == Triangle::kLower) ? Triangle::kUpper : Triangle::kLower) :
+                                  triangle;
+
+  // Solves the systems for a single right-hand side each. The block size has to be supported by the
+  // inversion routine: a multiple of 16 and at most 128.
+  const auto block_size = static_cast<size_t>(db_["TRSV_BLOCK_SIZE"]);
+  if ((block_size < 16) || (block_size > 128) || ((block_size & (block_size - 1)) != 0)) {
+    throw BLASError(StatusCode::kInvalidLocalThreadsTotal, "TRSV_BLOCK_SIZE");
+  }
+  const auto alphas = std::vector<T>(batch_count, ConstantOne<T>());
+  BatchedSolve(side, col_major_triangle, a_transpose, diagonal, n, 1, block_size, alphas,
+               a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, 0, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrsvBatched<half>;
+template class XtrsvBatched<float>;
+template class XtrsvBatched<double>;
+template class XtrsvBatched<float2>;
+template class XtrsvBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,50 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsvBatched routine. This is a non-blas batched version of TRSV. It
+// shares its implementation with the batched TRSM routine, solving for a single right-hand side.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSVBATCHED_H_
+#define CLBLAST_ROUTINES_XTRSVBATCHED_H_
+
+#include <vector>
+
+#include "routines/levelx/xtrsmbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XtrsvBatched: public XtrsmBatched<T> {
+ public:
+
+  // Uses methods and variables of the XtrsmBatched routine
+  using XtrsmBatched<T>::db_;
+  using XtrsmBatched<T>::BatchedSolve;
+
+  // Constructor
+  XtrsvBatched(Queue &queue, EventPointer event, const std::string &name = "TRSVBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoTrsvBatched(const Layout layout, const Triangle triangle,
+                     const Transpose a_transpose, const Diagonal diagonal,
+                     const size_t n,
+                     const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                     const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                     const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSVBATCHED_H_
+#endif
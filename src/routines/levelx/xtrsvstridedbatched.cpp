@@ -0,0 +1,66 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsvStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrsvstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XtrsvStridedBatched<T>::XtrsvStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    XtrsvBatched<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine: computes the offsets of each batch and forwards to the batched version
+template <typename T>
+void XtrsvStridedBatched<T>::DoTrsvStridedBatched(const Layout layout, const Triangle triangle,
+                                                  const Transpose a_transpose, const Diagonal diagonal,
+                                                  const size_t n,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Computes the offsets of each batch
+  auto a_offsets = std::vector<size_t>(batch_count);
+  auto x_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    a_offsets[batch] = a_offset + batch * a_stride;
+    x_offsets[batch] = x_offset + batch * x_stride;
+  }
+
+  // Runs the batched version of the routine
+  DoTrsvBatched(layout, triangle, a_transpose, diagonal, n,
+                a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XtrsvStridedBatched<half>;
+template class XtrsvStridedBatched<float>;
+template class XtrsvStridedBatched<double>;
+template class XtrsvStridedBatched<float2>;
+template class XtrsvStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
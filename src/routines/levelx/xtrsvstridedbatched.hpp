@@ -0,0 +1,49 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XtrsvStridedBatched routine. This is a non-blas batched version of TRSV
+// with a fixed stride between the matrices and vectors of subsequent batches.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRSVSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XTRSVSTRIDEDBATCHED_H_
+
+#include <vector>
+
+#include "routines/levelx/xtrsvbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XtrsvStridedBatched: public XtrsvBatched<T> {
+ public:
+
+  // Uses methods of the XtrsvBatched routine
+  using XtrsvBatched<T>::DoTrsvBatched;
+
+  // Constructor
+  XtrsvStridedBatched(Queue &queue, EventPointer event, const std::string &name = "TRSVSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoTrsvStridedBatched(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                            const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRSVSTRIDEDBATCHED_H_
+#endif
@@ -0,0 +1,54 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the process-wide accuracy mode of the routines.
+//
+// =================================================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#include "utilities/accuracy.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// Reads the initial accuracy mode from the environment (defaults to full accuracy)
+Accuracy InitialAccuracyMode() {
+  const auto environment_variable = std::getenv("CLBLAST_ACCURACY");
+  if (environment_variable != nullptr) {
+    const auto mode = std::string(environment_variable);
+    if (mode == "reduced") { return Accuracy::kReduced; }
+  }
+  return Accuracy::kFull;
+}
+
+// The current accuracy mode, stored as an integer to be able to use a lock-free atomic
+std::atomic<int> &AccuracyMode() {
+  static std::atomic<int> mode(static_cast<int>(InitialAccuracyMode()));
+  return mode;
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+Accuracy GetAccuracyMode() {
+  return static_cast<Accuracy>(AccuracyMode().load(std::memory_order_relaxed));
+}
+
+void SetAccuracyMode(const Accuracy accuracy) {
+  AccuracyMode().store(static_cast<int>(accuracy), std::memory_order_relaxed);
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,31 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file declares the process-wide accuracy mode of the routines (see the SetAccuracy function).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ACCURACY_H_
+#define CLBLAST_ACCURACY_H_
+
+#include "clblast.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Retrieves and sets the current accuracy mode. The initial mode is read from the CLBLAST_ACCURACY
+// environmental variable ('full' or 'reduced'), default is 'full'.
+Accuracy GetAccuracyMode();
+void SetAccuracyMode(const Accuracy accuracy);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ACCURACY_H_
+#endif
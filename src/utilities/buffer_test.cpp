@@ -0,0 +1,110 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the non-templated parts of the buffer tests: the process-wide level of
+// buffer validation and the lookup of buffer sizes through the cache.
+//
+// =================================================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "cache.hpp"
+#include "utilities/buffer_test.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// Reads the initial level of validation from the environment (defaults to full validation)
+BufferValidation InitialBufferValidationLevel() {
+  const auto environment_variable = std::getenv("CLBLAST_BUFFER_VALIDATION");
+  if (environment_variable != nullptr) {
+    const auto level = std::string(environment_variable);
+    if (level == "cached") { return BufferValidation::kCached; }
+    if (level == "off") { return BufferValidation::kOff; }
+  }
+  return BufferValidation::kFull;
+}
+
+// The current level of validation, stored as an integer to be able to use a lock-free atomic
+std::atomic<int> &BufferValidationLevel() {
+  static std::atomic<int> level(static_cast<int>(InitialBufferValidationLevel()));
+  return level;
+}
+
+// Whether or not the cache of buffer sizes can still be used. This is cleared when the static
+// objects are destroyed at exit, after which buffers released later are no longer removed from it.
+std::atomic<bool> buffer_size_cache_alive(true);
+struct BufferSizeCacheGuard {
+  ~BufferSizeCacheGuard() { buffer_size_cache_alive.store(false); }
+};
+
+// The buffers for which the destructor callback below is registered, such that it is registered
+// only once per buffer. This is kept apart from the cache, since the cache is invalidated when the
+// level of validation changes, whereas the callbacks stay registered. The mutex also guards the
+// check for an existing entry in the cache and the storing of a new one.
+std::mutex buffer_callbacks_mutex;
+std::set<cl_mem> buffers_with_callback;
+
+// Called by OpenCL when a buffer is released: its size is removed from the cache, since OpenCL
+// might re-use the same 'cl_mem' handle for a new (possibly smaller) buffer
+void CL_CALLBACK RemoveBufferSize(cl_mem buffer, void*) {
+  if (!buffer_size_cache_alive.load()) { return; }
+  std::lock_guard<std::mutex> lock(buffer_callbacks_mutex);
+  buffers_with_callback.erase(buffer);
+  BufferSizeCache::Instance().Remove(buffer);
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+BufferValidation GetBufferValidationLevel() {
+  return static_cast<BufferValidation>(BufferValidationLevel().load(std::memory_order_relaxed));
+}
+
+// Changing the level also drops all memoised sizes, which are not needed for the other levels
+void SetBufferValidationLevel(const BufferValidation validation) {
+  BufferValidationLevel().store(static_cast<int>(validation), std::memory_order_relaxed);
+  BufferSizeCache::Instance().Invalidate();
+}
+
+// =================================================================================================
+
+size_t GetCachedBufferSize(const cl_mem buffer) {
+  static BufferSizeCacheGuard guard; // constructed after the cache, so destroyed before it
+  bool in_cache;
+  const auto cached_size = BufferSizeCache::Instance().Get(buffer, &in_cache);
+  if (in_cache) { return cached_size; }
+
+  // Queries OpenCL for the size
+  auto size = size_t{0};
+  CheckError(clGetMemObjectInfo(buffer, CL_MEM_SIZE, sizeof(size_t), &size, nullptr));
+
+  // Makes sure the entry is removed again once the buffer is released. This is done before storing
+  // the size, such that the cache never holds an entry without a callback.
+  std::lock_guard<std::mutex> lock(buffer_callbacks_mutex);
+  if (buffers_with_callback.count(buffer) == 0) {
+    CheckError(clSetMemObjectDestructorCallback(buffer, RemoveBufferSize, nullptr));
+    buffers_with_callback.insert(buffer);
+  }
+
+  // Stores the size, unless another thread stored the same buffer in the mean time
+  BufferSizeCache::Instance().Get(buffer, &in_cache);
+  if (!in_cache) { BufferSizeCache::Instance().Store(BufferSizeKey{buffer}, size_t{size}); }
+  return size;
+}
+
+// =================================================================================================
+} // namespace clblast
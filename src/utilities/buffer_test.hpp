@@ -8,7 +8,8 @@
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
 // This file implements the tests for the OpenCL buffers (matrices and vectors). These tests are
-// templated and thus header-only.
+// templated and thus header-only. The size checks depend on the process-wide validation level,
+// which is implemented together with the buffer-size cache in buffer_test.cpp.
 //
 // =================================================================================================
 
@@ -20,6 +21,27 @@
 namespace clblast {
 // =================================================================================================
 
+// Retrieves and sets the current level of buffer validation. The initial level is read from the
+// CLBLAST_BUFFER_VALIDATION environmental variable ('full', 'cached' or 'off'), default is 'full'.
+BufferValidation GetBufferValidationLevel();
+void SetBufferValidationLevel(const BufferValidation validation);
+
+// Retrieves the size in bytes of an OpenCL buffer through the cache of buffer sizes
+size_t GetCachedBufferSize(const cl_mem buffer);
+
+// Returns whether the buffer is smaller than the required size in bytes. Depending on the level of
+// validation the size is queried from OpenCL, from the cache, or not at all.
+template <typename T>
+bool IsBufferTooSmall(const Buffer<T> &buffer, const size_t required_size) {
+  switch (GetBufferValidationLevel()) {
+    case BufferValidation::kOff: return false;
+    case BufferValidation::kCached: return GetCachedBufferSize(buffer()) < required_size;
+    default: return buffer.GetSize() < required_size;
+  }
+}
+
+// =================================================================================================
+
 // Tests matrix 'A' for validity
 template <typename T>
 void TestMatrixA(const size_t one, const size_t two, const Buffer<T> &buffer,
@@ -27,7 +49,7 @@ void TestMatrixA(const size_t one, const size_t two, const Buffer<T> &buffer,
   if (ld < one) { throw BLASError(StatusCode::kInvalidLeadDimA); }
   try {
     const auto required_size = (ld * (two - 1) + one + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryA); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryA); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
 }
 
@@ -38,7 +60,7 @@ void TestMatrixB(const size_t one, const size_t two, const Buffer<T> &buffer,
   if (ld < one) { throw BLASError(StatusCode::kInvalidLeadDimB); }
   try {
     const auto required_size = (ld * (two - 1) + one + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryB); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryB); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixB, e.what()); }
 }
 
@@ -49,7 +71,7 @@ void TestMatrixC(const size_t one, const size_t two, const Buffer<T> &buffer,
   if (ld < one) { throw BLASError(StatusCode::kInvalidLeadDimC); }
   try {
     const auto required_size = (ld * (two - 1) + one + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryC); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryC); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixC, e.what()); }
 }
 
@@ -58,7 +80,7 @@ template <typename T>
 void TestMatrixAP(const size_t n, const Buffer<T> &buffer, const size_t offset) {
   try {
     const auto required_size = (((n * (n + 1)) / 2) + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryA); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryA); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
 }
 
@@ -70,7 +92,7 @@ void TestVectorX(const size_t n, const Buffer<T> &buffer, const size_t offset, c
   if (inc == 0) { throw BLASError(StatusCode::kInvalidIncrementX); }
   try {
     const auto required_size = ((n - 1) * inc + 1 + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryX); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryX); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorX, e.what()); }
 }
 
@@ -80,7 +102,7 @@ void TestVectorY(const size_t n, const Buffer<T> &buffer, const size_t offset, c
   if (inc == 0) { throw BLASError(StatusCode::kInvalidIncrementY); }
   try {
     const auto required_size = ((n - 1) * inc + 1 + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryY); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryY); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorY, e.what()); }
 }
 
@@ -91,7 +113,7 @@ template <typename T>
 void TestVectorScalar(const size_t n, const Buffer<T> &buffer, const size_t offset) {
   try {
     const auto required_size = (n + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorScalar, e.what()); }
 }
 
@@ -100,10 +122,30 @@ template <typename T>
 void TestVectorIndex(const size_t n, const Buffer<T> &buffer, const size_t offset) {
   try {
     const auto required_size = (n + offset) * sizeof(T);
-    if (buffer.GetSize() < required_size) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryScalar); }
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorScalar, e.what()); }
 }
 
+// =================================================================================================
+
+// Tests the epilogue's vector 'bias' for validity
+template <typename T>
+void TestVectorBias(const size_t n, const Buffer<T> &buffer, const size_t offset) {
+  try {
+    const auto required_size = (n + offset) * sizeof(T);
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryBias); }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorBias, e.what()); }
+}
+
+// Tests the epilogue's vector 'scale' for validity
+template <typename T>
+void TestVectorScale(const size_t n, const Buffer<T> &buffer, const size_t offset) {
+  try {
+    const auto required_size = (n + offset) * sizeof(T);
+    if (IsBufferTooSmall(buffer, required_size)) { throw BLASError(StatusCode::kInsufficientMemoryScale); }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidVectorScale, e.what()); }
+}
+
 // =================================================================================================
 } // namespace clblast
 
@@ -110,6 +110,7 @@ constexpr auto kArgStepSize = "step";
 constexpr auto kArgNumSteps = "num_steps";
 constexpr auto kArgNumRuns = "runs";
 constexpr auto kArgWarmUp = "warm_up";
+constexpr auto kArgReducedAccuracy = "reduced_accuracy";
 
 // The test-specific arguments in string form
 constexpr auto kArgFullTest = "full_test";
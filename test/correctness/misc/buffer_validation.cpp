@@ -0,0 +1,122 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the SetBufferValidation function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "test/correctness/misctester.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunBufferValidationTests(int argc, char *argv[], const bool silent,
+                                const std::string &routine_name) {
+  auto tester = MiscTester(argc, argv, silent);
+  auto &queue = tester.queue();
+  auto example_routine = TestXgemm<T>();
+
+  // The GEMM arguments
+  auto args = Arguments<T>{};
+  args.m = 64;
+  args.n = 64;
+  args.k = 64;
+  args.a_ld = args.k;
+  args.b_ld = args.n;
+  args.c_ld = args.n;
+  args.layout = Layout::kRowMajor;
+  args.a_transpose = Transpose::kNo;
+  args.b_transpose = Transpose::kNo;
+  args.alpha = GetScalar<T>();
+  args.beta  = GetScalar<T>();
+
+  // Populate host matrices with some example data
+  std::mt19937 mt(kMiscTestSeed);
+  const auto host_a = RandomVector<T>(args.m * args.k, mt);
+  const auto host_b = RandomVector<T>(args.n * args.k, mt);
+  const auto host_c = RandomVector<T>(args.m * args.n, mt);
+
+  // Copy the matrices to the device, including a 'C' matrix which is one element too small
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_b = tester.CopyToDevice(host_b);
+  auto device_c = tester.CopyToDevice(host_c);
+  auto device_c_small = Buffer<T>(tester.context(), host_c.size() - 1);
+  auto dummy = Buffer<T>(tester.context(), 1);
+  auto buffers = Buffers<T>{dummy, dummy, device_a, device_b, device_c, dummy, dummy};
+  auto buffers_small = Buffers<T>{dummy, dummy, device_a, device_b, device_c_small, dummy, dummy};
+
+  // Runs with valid and too small buffers (twice to hit the cache of buffer sizes as well)
+  fprintf(stdout, "* Testing SetBufferValidation for '%s'\n", routine_name.c_str());
+  for (const auto validation : {BufferValidation::kFull, BufferValidation::kCached}) {
+    if (SetBufferValidation(validation) != StatusCode::kSuccess) {
+      tester.AddResult(false); continue;
+    }
+    for (auto repeat = 0; repeat < 2; ++repeat) {
+      const auto status = example_routine.RunRoutine(args, buffers, queue);
+      tester.AddResult(status == StatusCode::kSuccess);
+      const auto status_small = example_routine.RunRoutine(args, buffers_small, queue);
+      tester.AddResult(status_small == StatusCode::kInsufficientMemoryC);
+    }
+  }
+
+  // Releases and re-creates the 'C' buffer with the cached level, alternating between a valid and
+  // a too small size. OpenCL might re-use the handle of a released buffer, in which case its cached
+  // size should have been removed upon release.
+  if (SetBufferValidation(BufferValidation::kCached) != StatusCode::kSuccess) {
+    tester.AddResult(false);
+  }
+  auto reallocation_errors = size_t{0};
+  for (auto repeat = 0; repeat < 8; ++repeat) {
+    const auto is_small = (repeat % 2 == 1);
+    auto device_c_new = Buffer<T>(tester.context(), (is_small) ? host_c.size() - 1 : host_c.size());
+    if (!is_small) { device_c_new.Write(queue, host_c.size(), host_c); }
+    auto buffers_new = Buffers<T>{dummy, dummy, device_a, device_b, device_c_new, dummy, dummy};
+    const auto status_new = example_routine.RunRoutine(args, buffers_new, queue);
+    const auto expected = (is_small) ? StatusCode::kInsufficientMemoryC : StatusCode::kSuccess;
+    if (status_new != expected) { reallocation_errors++; }
+    queue.Finish();
+  }
+  tester.AddResult(reallocation_errors == 0);
+
+  // Runs with valid buffers and without any buffer-size checks, but with invalid leading dimensions
+  if (SetBufferValidation(BufferValidation::kOff) != StatusCode::kSuccess) {
+    tester.AddResult(false);
+  }
+  const auto status = example_routine.RunRoutine(args, buffers, queue);
+  tester.AddResult(status == StatusCode::kSuccess);
+  auto args_invalid_ld = args;
+  args_invalid_ld.c_ld = args.n - 1;
+  const auto status_invalid_ld = example_routine.RunRoutine(args_invalid_ld, buffers, queue);
+  tester.AddResult(status_invalid_ld == StatusCode::kInvalidLeadDimC);
+
+  // Restores the default
+  if (SetBufferValidation(BufferValidation::kFull) != StatusCode::kSuccess) {
+    tester.AddResult(false);
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunBufferValidationTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunBufferValidationTests<clblast::float2>(argc, argv, true, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,108 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the complex Gemm3m function, comparing against a simple
+// reference implementation on the host
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <complex>
+
+#include "test/correctness/misctester.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemm3mTests(int argc, char *argv[], const bool silent,
+                      const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  const auto alpha = T{0.5, -1.5};
+  const auto beta = T{2.0, 0.5};
+
+  // The test cases: multiples and non-multiples of the tile sizes with all layouts and transposes
+  const auto test_cases = std::vector<GemmTestCase>{
+    {64, 64, 64, Layout::kRowMajor, Transpose::kNo, Transpose::kNo},
+    {67, 33, 41, Layout::kRowMajor, Transpose::kConjugate, Transpose::kNo},
+    {67, 33, 41, Layout::kColMajor, Transpose::kNo, Transpose::kYes},
+    {129, 97, 300, Layout::kColMajor, Transpose::kYes, Transpose::kConjugate},
+    {256, 200, 512, Layout::kRowMajor, Transpose::kNo, Transpose::kConjugate},
+  };
+
+  fprintf(stdout, "* Testing Gemm3m for '%s'\n", routine_name.c_str());
+  for (const auto &test : test_cases) {
+    const auto a_ld = GemmALeadDim(test);
+    const auto b_ld = GemmBLeadDim(test);
+    const auto c_ld = GemmCLeadDim(test);
+
+    // Populate host matrices with some example data
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(test.m * test.k, mt);
+    const auto host_b = RandomVector<T>(test.k * test.n, mt);
+    const auto host_c = RandomVector<T>(test.m * test.n, mt);
+
+    // Runs the routine
+    auto device_a = tester.CopyToDevice(host_a);
+    auto device_b = tester.CopyToDevice(host_b);
+    auto device_c = tester.CopyToDevice(host_c);
+    auto queue_plain = tester.queue()();
+    auto event = cl_event{nullptr};
+    const auto status = Gemm3m(test.layout, test.a_transpose, test.b_transpose,
+                               test.m, test.n, test.k, alpha,
+                               device_a(), 0, a_ld, device_b(), 0, b_ld,
+                               beta, device_c(), 0, c_ld,
+                               &queue_plain, &event);
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    WaitForEvent(event);
+    const auto result = tester.CopyToHost(device_c, host_c.size());
+
+    // Computes the reference on the host in double precision complex, conjugating A and B if needed
+    const auto element = [&](const T value, const Transpose transpose) {
+      return (transpose == Transpose::kConjugate) ? std::conj(ToComplex(value)) : ToComplex(value);
+    };
+    auto reference = std::vector<std::complex<double>>(host_c.size());
+    for (auto row = size_t{0}; row < test.m; ++row) {
+      for (auto col = size_t{0}; col < test.n; ++col) {
+        auto value = std::complex<double>{0.0, 0.0};
+        for (auto id = size_t{0}; id < test.k; ++id) {
+          const auto a_index = (test.a_transpose == Transpose::kNo) ?
+                               MatrixIndex(test.layout, row, id, a_ld) :
+                               MatrixIndex(test.layout, id, row, a_ld);
+          const auto b_index = (test.b_transpose == Transpose::kNo) ?
+                               MatrixIndex(test.layout, id, col, b_ld) :
+                               MatrixIndex(test.layout, col, id, b_ld);
+          value += element(host_a[a_index], test.a_transpose) *
+                   element(host_b[b_index], test.b_transpose);
+        }
+        const auto c_index = MatrixIndex(test.layout, row, col, c_ld);
+        reference[c_index] = ToComplex(alpha) * value +
+                             ToComplex(beta) * ToComplex(host_c[c_index]);
+      }
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemm3mTests<clblast::float2>(argc, argv, false, "CGEMM3M", 1e-3);
+  errors += clblast::RunGemm3mTests<clblast::double2>(argc, argv, true, "ZGEMM3M", 1e-9);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
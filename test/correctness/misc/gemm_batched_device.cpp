@@ -0,0 +1,183 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for batched GEMM with the scalars and offsets in device memory. The
+// batches are stored in reverse order, each at a different offset within its part of the buffers,
+// such that the per-batch offsets are non-zero and not a multiple of each other. The last cases
+// force the in-direct version through the 'KernelSelectionBatched' parameters. Finally, buffers of
+// scalars and offsets which hold fewer values than the batch count are checked to be reported as
+// such.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <utility>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The scalars and offsets of a batched GEMM, which are copied to the device
+template <typename T>
+struct GemmBatchedArguments {
+  std::vector<T> alphas;
+  std::vector<T> betas;
+  std::vector<int> a_offsets;
+  std::vector<int> b_offsets;
+  std::vector<int> c_offsets;
+};
+
+// Runs a single batched GEMM with its arguments in device memory and returns the result
+template <typename T>
+StatusCode RunGemmBatchedDevice(MiscTester &tester, const GemmTestCase &test,
+                                const size_t batch_count, const GemmBatchedArguments<T> &args,
+                                const std::vector<T> &host_a, const std::vector<T> &host_b,
+                                const std::vector<T> &host_c, std::vector<T> &result) {
+  auto device_alphas = tester.CopyToDevice(args.alphas);
+  auto device_betas = tester.CopyToDevice(args.betas);
+  auto device_a_offsets = tester.CopyToDevice(args.a_offsets);
+  auto device_b_offsets = tester.CopyToDevice(args.b_offsets);
+  auto device_c_offsets = tester.CopyToDevice(args.c_offsets);
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_b = tester.CopyToDevice(host_b);
+  auto device_c = tester.CopyToDevice(host_c);
+  auto queue_plain = tester.queue()();
+  auto event = cl_event{nullptr};
+  const auto status = GemmBatched<T>(test.layout, test.a_transpose, test.b_transpose,
+                                     test.m, test.n, test.k, device_alphas(),
+                                     device_a(), device_a_offsets(), GemmALeadDim(test),
+                                     device_b(), device_b_offsets(), GemmBLeadDim(test),
+                                     device_betas(),
+                                     device_c(), device_c_offsets(), GemmCLeadDim(test),
+                                     batch_count, &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return status; }
+  WaitForEvent(event);
+  result = tester.CopyToHost(device_c, host_c.size());
+  return StatusCode::kSuccess;
+}
+
+template <typename T>
+size_t RunGemmBatchedDeviceTests(int argc, char *argv[], const bool silent,
+                                 const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kGap = size_t{7}; // additional space in between the batches
+  constexpr auto kNumRegularCases = size_t{3};
+
+  // The checks for too small buffers below require the buffers to be fully validated
+  if (SetBufferValidation(BufferValidation::kFull) != StatusCode::kSuccess) { return 1; }
+
+  // The test cases: tiny, odd and tile-sized matrices with all layouts and transposes, each with a
+  // batch count below the gap. The first case also serves to load the 'KernelSelectionBatched'
+  // parameters in the cache. The remaining cases after the regular ones run in-direct and are
+  // chosen close to a multiple of the tile sizes, such that padding doesn't send them to the
+  // direct kernel.
+  const auto test_cases = std::vector<std::pair<GemmTestCase, size_t>>{
+    {{8, 8, 8, Layout::kColMajor, Transpose::kNo, Transpose::kNo}, 5},
+    {{33, 65, 17, Layout::kRowMajor, Transpose::kNo, Transpose::kYes}, 3},
+    {{64, 40, 70, Layout::kColMajor, Transpose::kYes, Transpose::kNo}, 4},
+    {{128, 128, 128, Layout::kColMajor, Transpose::kNo, Transpose::kYes}, 3},
+    {{120, 128, 128, Layout::kRowMajor, Transpose::kYes, Transpose::kYes}, 2},
+  };
+
+  fprintf(stdout, "* Testing batched GEMM with arguments in device memory for '%s'\n",
+          routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id].first;
+    const auto batch_count = test_cases[test_id].second;
+
+    // Populate host matrices and scalars with some example data. Batch 'b' is stored in part
+    // 'batch_count - 1 - b' of the buffers, shifted by 'b' elements.
+    const auto a_stride = test.m * test.k + kGap;
+    const auto b_stride = test.k * test.n + kGap;
+    const auto c_stride = test.m * test.n + kGap;
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(a_stride * batch_count, mt);
+    const auto host_b = RandomVector<T>(b_stride * batch_count, mt);
+    const auto host_c = RandomVector<T>(c_stride * batch_count, mt);
+    auto args = GemmBatchedArguments<T>();
+    args.alphas = RandomVector<T>(batch_count, mt);
+    args.betas = RandomVector<T>(batch_count, mt);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      const auto part = batch_count - 1 - batch;
+      args.a_offsets.push_back(static_cast<int>(part * a_stride + batch));
+      args.b_offsets.push_back(static_cast<int>(part * b_stride + batch));
+      args.c_offsets.push_back(static_cast<int>(part * c_stride + batch));
+    }
+
+    // Forces the in-direct version after the regular cases
+    if (test_id == kNumRegularCases) {
+      const auto parameters = std::unordered_map<std::string,size_t>{
+        {"XGEMM_BATCHED_MIN_INDIRECT_SIZE", 0}
+      };
+      if (OverrideParameters(tester.device()(), "KernelSelectionBatched", PrecisionValue<T>(),
+                             parameters) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+    }
+
+    // Runs the routine
+    auto result = std::vector<T>();
+    if (RunGemmBatchedDevice(tester, test, batch_count, args, host_a, host_b, host_c,
+                             result) != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+
+    // Compares against the reference. The gaps in between the batches should be left untouched.
+    auto reference = ToDoubleVector(host_c);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      ReferenceGemm(test, ToDouble(args.alphas[batch]), ToDouble(args.betas[batch]),
+                    host_a, static_cast<size_t>(args.a_offsets[batch]),
+                    host_b, static_cast<size_t>(args.b_offsets[batch]),
+                    reference, static_cast<size_t>(args.c_offsets[batch]));
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+
+  // Checks that each of the buffers of scalars and offsets is reported as too small when it holds
+  // one value less than the batch count
+  const auto test = GemmTestCase{8, 8, 8, Layout::kColMajor, Transpose::kNo, Transpose::kNo};
+  constexpr auto kBatchCount = size_t{3};
+  const auto host_a = std::vector<T>(test.m * test.k * kBatchCount, static_cast<T>(1.0));
+  const auto host_b = std::vector<T>(test.k * test.n * kBatchCount, static_cast<T>(1.0));
+  const auto host_c = std::vector<T>(test.m * test.n * kBatchCount, static_cast<T>(1.0));
+  auto valid_args = GemmBatchedArguments<T>();
+  valid_args.alphas = std::vector<T>(kBatchCount, static_cast<T>(1.0));
+  valid_args.betas = std::vector<T>(kBatchCount, static_cast<T>(1.0));
+  valid_args.a_offsets = std::vector<int>(kBatchCount, 0);
+  valid_args.b_offsets = std::vector<int>(kBatchCount, 0);
+  valid_args.c_offsets = std::vector<int>(kBatchCount, 0);
+  for (auto buffer_id = size_t{0}; buffer_id < 5; ++buffer_id) {
+    auto args = valid_args;
+    if (buffer_id == 0) { args.alphas.pop_back(); }
+    if (buffer_id == 1) { args.betas.pop_back(); }
+    if (buffer_id == 2) { args.a_offsets.pop_back(); }
+    if (buffer_id == 3) { args.b_offsets.pop_back(); }
+    if (buffer_id == 4) { args.c_offsets.pop_back(); }
+    auto result = std::vector<T>();
+    const auto status = RunGemmBatchedDevice(tester, test, kBatchCount, args,
+                                             host_a, host_b, host_c, result);
+    tester.AddResult(status == StatusCode::kInsufficientMemoryScalar);
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmBatchedDeviceTests<float>(argc, argv, false, "SGEMMBATCHED", 1e-3);
+  errors += clblast::RunGemmBatchedDeviceTests<double>(argc, argv, true, "DGEMMBATCHED", 1e-10);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,136 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the in-direct version of batched GEMM, with pre/post-processing
+// kernels. It is forced through the 'KernelSelectionBatched' parameters. The sizes are chosen close
+// to a multiple of the tile sizes, such that padding doesn't send them to the direct kernel. The
+// results are compared against a simple reference implementation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <utility>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs a single batched GEMM and returns the result. Each batch is stored in its own part of the
+// buffers, with an additional gap in between to test the offsets.
+template <typename T>
+StatusCode RunGemmBatched(MiscTester &tester, const GemmTestCase &test, const size_t batch_count,
+                          const std::vector<T> &alphas, const std::vector<T> &betas,
+                          const std::vector<T> &host_a, const std::vector<T> &host_b,
+                          const std::vector<T> &host_c, std::vector<T> &result) {
+  auto a_offsets = std::vector<size_t>(batch_count);
+  auto b_offsets = std::vector<size_t>(batch_count);
+  auto c_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    a_offsets[batch] = batch * (host_a.size() / batch_count);
+    b_offsets[batch] = batch * (host_b.size() / batch_count);
+    c_offsets[batch] = batch * (host_c.size() / batch_count);
+  }
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_b = tester.CopyToDevice(host_b);
+  auto device_c = tester.CopyToDevice(host_c);
+  auto queue_plain = tester.queue()();
+  auto event = cl_event{nullptr};
+  const auto status = GemmBatched(test.layout, test.a_transpose, test.b_transpose,
+                                  test.m, test.n, test.k, alphas.data(),
+                                  device_a(), a_offsets.data(), GemmALeadDim(test),
+                                  device_b(), b_offsets.data(), GemmBLeadDim(test), betas.data(),
+                                  device_c(), c_offsets.data(), GemmCLeadDim(test), batch_count,
+                                  &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return status; }
+  WaitForEvent(event);
+  result = tester.CopyToHost(device_c, host_c.size());
+  return StatusCode::kSuccess;
+}
+
+template <typename T>
+size_t RunGemmBatchedIndirectTests(int argc, char *argv[], const bool silent,
+                                   const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kGap = size_t{7}; // additional space in between the batches
+
+  // The test cases: multiples of and sizes just below a multiple of 128 with all layouts and
+  // transposes, each with a batch count. The first case also serves to load the
+  // 'KernelSelectionBatched' parameters in the cache.
+  const auto test_cases = std::vector<std::pair<GemmTestCase, size_t>>{
+    {{128, 128, 128, Layout::kColMajor, Transpose::kNo, Transpose::kNo}, 2},
+    {{128, 256, 128, Layout::kColMajor, Transpose::kNo, Transpose::kNo}, 3},
+    {{250, 240, 255, Layout::kRowMajor, Transpose::kNo, Transpose::kYes}, 2},
+    {{256, 120, 250, Layout::kColMajor, Transpose::kYes, Transpose::kNo}, 4},
+    {{127, 250, 128, Layout::kRowMajor, Transpose::kYes, Transpose::kYes}, 3},
+  };
+
+  fprintf(stdout, "* Testing the in-direct version of batched GEMM for '%s'\n",
+          routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id].first;
+    const auto batch_count = test_cases[test_id].second;
+
+    // Populate host matrices and scalars with some example data
+    const auto a_stride = test.m * test.k + kGap;
+    const auto b_stride = test.k * test.n + kGap;
+    const auto c_stride = test.m * test.n + kGap;
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(a_stride * batch_count, mt);
+    const auto host_b = RandomVector<T>(b_stride * batch_count, mt);
+    const auto host_c = RandomVector<T>(c_stride * batch_count, mt);
+    const auto alphas = RandomVector<T>(batch_count, mt);
+    const auto betas = RandomVector<T>(batch_count, mt);
+
+    // Forces the in-direct version after the first (regular) run
+    if (test_id == 0) {
+      auto result = std::vector<T>();
+      if (RunGemmBatched(tester, test, batch_count, alphas, betas, host_a, host_b, host_c,
+                         result) != StatusCode::kSuccess) { tester.AddResult(false); break; }
+      const auto parameters = std::unordered_map<std::string,size_t>{
+        {"XGEMM_BATCHED_MIN_INDIRECT_SIZE", 0}
+      };
+      if (OverrideParameters(tester.device()(), "KernelSelectionBatched", PrecisionValue<T>(),
+                             parameters) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+    }
+
+    // Runs the routine
+    auto result = std::vector<T>();
+    if (RunGemmBatched(tester, test, batch_count, alphas, betas, host_a, host_b, host_c,
+                       result) != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+
+    // Compares against the reference. The gaps in between the batches should be left untouched.
+    auto reference = ToDoubleVector(host_c);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      ReferenceGemm(test, ToDouble(alphas[batch]), ToDouble(betas[batch]),
+                    host_a, batch * a_stride, host_b, batch * b_stride,
+                    reference, batch * c_stride);
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmBatchedIndirectTests<float>(argc, argv, false, "SGEMMBATCHED", 1e-3);
+  errors += clblast::RunGemmBatchedIndirectTests<double>(argc, argv, true, "DGEMMBATCHED", 1e-10);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,167 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the GemmEpilogue function, comparing against a simple reference
+// implementation on the host. Finally, bias and scaling vectors which hold fewer values than the
+// rows or columns of C are checked to be reported as such.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+#include "test/correctness/misctester.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single test: the sizes and the epilogue arguments
+struct EpilogueTestCase {
+  size_t m;
+  size_t n;
+  size_t k;
+  EpilogueMode bias_mode;
+  Activation activation;
+  EpilogueMode scale_mode;
+};
+
+// Reference implementation of the activation functions
+double ReferenceActivation(const Activation activation, const double value,
+                           const double clip_min, const double clip_max) {
+  switch (activation) {
+    case Activation::kRelu: return std::max(value, 0.0);
+    case Activation::kRelu6: return std::min(std::max(value, 0.0), 6.0);
+    case Activation::kClip: return std::min(std::max(value, clip_min), clip_max);
+    case Activation::kSigmoid: return 0.5 + 0.5 * value / (1.0 + std::fabs(value));
+    default: return value;
+  }
+}
+
+template <typename T>
+size_t RunGemmEpilogueTests(int argc, char *argv[], const bool silent,
+                            const std::string &routine_name) {
+  auto tester = MiscTester(argc, argv, silent);
+  const auto alpha = GetScalar<T>();
+  const auto beta = GetScalar<T>();
+  const auto clip_min = static_cast<T>(-0.5);
+  const auto clip_max = static_cast<T>(0.5);
+
+  // The test cases: small sizes for the direct GEMM kernel and larger sizes for the in-direct one
+  const auto test_cases = std::vector<EpilogueTestCase>{
+    {67, 33, 41, EpilogueMode::kPerRow, Activation::kRelu, EpilogueMode::kNone},
+    {67, 33, 41, EpilogueMode::kPerColumn, Activation::kSigmoid, EpilogueMode::kPerRow},
+    {64, 64, 64, EpilogueMode::kNone, Activation::kClip, EpilogueMode::kPerColumn},
+    {517, 259, 300, EpilogueMode::kPerRow, Activation::kRelu6, EpilogueMode::kPerColumn},
+    {512, 512, 512, EpilogueMode::kPerColumn, Activation::kNone, EpilogueMode::kNone},
+  };
+
+  fprintf(stdout, "* Testing GemmEpilogue for '%s'\n", routine_name.c_str());
+  for (const auto &test : test_cases) {
+    const auto m = test.m;
+    const auto n = test.n;
+    const auto k = test.k;
+
+    // Populate host matrices and vectors with some example data (row-major, non-transposed)
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(m * k, mt);
+    const auto host_b = RandomVector<T>(k * n, mt);
+    const auto host_c = RandomVector<T>(m * n, mt);
+    const auto host_bias = RandomVector<T>(std::max(m, n), mt);
+    const auto host_scale = RandomVector<T>(std::max(m, n), mt);
+
+    // Runs the routine
+    auto device_a = tester.CopyToDevice(host_a);
+    auto device_b = tester.CopyToDevice(host_b);
+    auto device_c = tester.CopyToDevice(host_c);
+    auto device_bias = tester.CopyToDevice(host_bias);
+    auto device_scale = tester.CopyToDevice(host_scale);
+    auto queue_plain = tester.queue()();
+    auto event = cl_event{nullptr};
+    const auto status = GemmEpilogue(Layout::kRowMajor, Transpose::kNo, Transpose::kNo,
+                                     m, n, k, alpha,
+                                     device_a(), 0, k, device_b(), 0, n,
+                                     beta, device_c(), 0, n,
+                                     test.bias_mode, device_bias(), 0,
+                                     test.activation, clip_min, clip_max,
+                                     test.scale_mode, device_scale(), 0,
+                                     &queue_plain, &event);
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    WaitForEvent(event);
+    const auto result = tester.CopyToHost(device_c, host_c.size());
+
+    // Computes the reference on the host: the regular GEMM followed by the epilogue
+    const auto gemm = GemmTestCase{m, n, k, Layout::kRowMajor, Transpose::kNo, Transpose::kNo};
+    auto reference = ToDoubleVector(host_c);
+    ReferenceGemm(gemm, ToDouble(alpha), ToDouble(beta), host_a, 0, host_b, 0, reference, 0);
+    for (auto row = size_t{0}; row < m; ++row) {
+      for (auto col = size_t{0}; col < n; ++col) {
+        const auto vector_index = [&](const EpilogueMode mode) {
+          return (mode == EpilogueMode::kPerRow) ? row : col;
+        };
+        auto &value = reference[row * n + col];
+        if (test.bias_mode != EpilogueMode::kNone) {
+          value += ToDouble(host_bias[vector_index(test.bias_mode)]);
+        }
+        value = ReferenceActivation(test.activation, value, ToDouble(clip_min), ToDouble(clip_max));
+        if (test.scale_mode != EpilogueMode::kNone) {
+          value *= ToDouble(host_scale[vector_index(test.scale_mode)]);
+        }
+      }
+    }
+    tester.AddResult(CompareResults(result, reference, 1e-3));
+  }
+
+  // Checks that a bias or scaling vector is reported as too small when it holds one value less than
+  // the rows of C, each with its own status code
+  if (SetBufferValidation(BufferValidation::kFull) != StatusCode::kSuccess) {
+    tester.AddResult(false);
+    return tester.PrintStatistics();
+  }
+  const auto m = size_t{8};
+  const auto n = size_t{16};
+  const auto k = size_t{8};
+  auto device_a = tester.CopyToDevice(std::vector<T>(m * k, static_cast<T>(1.0)));
+  auto device_b = tester.CopyToDevice(std::vector<T>(k * n, static_cast<T>(1.0)));
+  auto device_c = tester.CopyToDevice(std::vector<T>(m * n, static_cast<T>(1.0)));
+  auto device_vector = tester.CopyToDevice(std::vector<T>(m - 1, static_cast<T>(1.0)));
+  for (const auto is_bias : {true, false}) {
+    const auto bias_mode = (is_bias) ? EpilogueMode::kPerRow : EpilogueMode::kNone;
+    const auto scale_mode = (is_bias) ? EpilogueMode::kNone : EpilogueMode::kPerRow;
+    auto queue_plain = tester.queue()();
+    auto event = cl_event{nullptr};
+    const auto status = GemmEpilogue(Layout::kRowMajor, Transpose::kNo, Transpose::kNo,
+                                     m, n, k, alpha,
+                                     device_a(), 0, k, device_b(), 0, n,
+                                     beta, device_c(), 0, n,
+                                     bias_mode, device_vector(), 0,
+                                     Activation::kNone, clip_min, clip_max,
+                                     scale_mode, device_vector(), 0,
+                                     &queue_plain, &event);
+    const auto expected = (is_bias) ? StatusCode::kInsufficientMemoryBias :
+                                      StatusCode::kInsufficientMemoryScale;
+    tester.AddResult(status == expected);
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmEpilogueTests<float>(argc, argv, false, "SGEMMEPILOGUE");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
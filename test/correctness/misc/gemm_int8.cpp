@@ -0,0 +1,150 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the quantised GemmInt8 function, comparing against a simple
+// integer reference implementation on the host
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+#include "test/correctness/misctester.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single test: the sizes, layout, transpose arguments, types and scaling mode
+struct Int8TestCase {
+  GemmTestCase gemm;
+  QuantizedType a_type;
+  QuantizedType b_type;
+  EpilogueMode scale_mode;
+};
+
+// Computes the expected value of matrix C from the 32-bit accumulator and the scaling factor. The
+// requantisation is done in single precision with round-to-nearest-even, as in the kernel.
+double ExpectedResult(const cl_char, const int accumulator, const float multiplier,
+                      const int c_zero_point) {
+  const auto value = std::nearbyint(multiplier * static_cast<float>(accumulator)) + c_zero_point;
+  return std::min(std::max(static_cast<double>(value), -128.0), 127.0);
+}
+double ExpectedResult(const cl_int, const int accumulator, const float, const int) {
+  return static_cast<double>(accumulator);
+}
+double ExpectedResult(const float, const int accumulator, const float multiplier, const int) {
+  return static_cast<double>(multiplier) * static_cast<double>(accumulator);
+}
+
+template <typename T>
+size_t RunGemmInt8Tests(int argc, char *argv[], const bool silent,
+                        const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  const auto scale = 0.002f;
+  const auto c_zero_point = 3;
+
+  // The test cases: multiples and non-multiples of the tile sizes with all layouts and transposes
+  const auto kInt8 = QuantizedType::kInt8;
+  const auto kUint8 = QuantizedType::kUint8;
+  const auto kNone = EpilogueMode::kNone;
+  const auto kPerRow = EpilogueMode::kPerRow;
+  const auto kPerColumn = EpilogueMode::kPerColumn;
+  const auto test_cases = std::vector<Int8TestCase>{
+    {{64, 64, 64, Layout::kRowMajor, Transpose::kNo, Transpose::kNo}, kInt8, kInt8, kNone},
+    {{67, 33, 41, Layout::kRowMajor, Transpose::kYes, Transpose::kNo}, kUint8, kInt8, kPerRow},
+    {{67, 33, 41, Layout::kColMajor, Transpose::kNo, Transpose::kYes}, kInt8, kUint8, kPerColumn},
+    {{129, 97, 300, Layout::kColMajor, Transpose::kYes, Transpose::kYes}, kUint8, kUint8, kNone},
+    {{256, 200, 512, Layout::kRowMajor, Transpose::kNo, Transpose::kYes}, kUint8, kInt8, kPerColumn}
+  };
+
+  fprintf(stdout, "* Testing GemmInt8 for '%s'\n", routine_name.c_str());
+  for (const auto &test : test_cases) {
+    const auto &gemm = test.gemm;
+    const auto a_zero_point = (test.a_type == kUint8) ? 128 : -5;
+    const auto b_zero_point = (test.b_type == kUint8) ? 120 : 7;
+
+    // Populate host matrices and the scaling factors with some example data
+    auto host_a = std::vector<cl_uchar>(gemm.m * gemm.k);
+    auto host_b = std::vector<cl_uchar>(gemm.k * gemm.n);
+    auto host_c = std::vector<T>(gemm.m * gemm.n);
+    auto host_scale = std::vector<float>(std::max(gemm.m, gemm.n));
+    std::mt19937 mt(kMiscTestSeed);
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    std::uniform_real_distribution<float> scale_dist(0.5f, 2.0f);
+    for (auto &value: host_a) { value = static_cast<cl_uchar>(byte_dist(mt)); }
+    for (auto &value: host_b) { value = static_cast<cl_uchar>(byte_dist(mt)); }
+    for (auto &value: host_scale) { value = scale_dist(mt); }
+
+    // Runs the routine
+    auto device_a = tester.CopyToDevice(host_a);
+    auto device_b = tester.CopyToDevice(host_b);
+    auto device_c = tester.CopyToDevice(host_c);
+    auto device_scale = tester.CopyToDevice(host_scale);
+    auto queue_plain = tester.queue()();
+    auto event = cl_event{nullptr};
+    const auto status = GemmInt8<T>(gemm.layout, gemm.a_transpose, gemm.b_transpose,
+                                    gemm.m, gemm.n, gemm.k,
+                                    test.a_type, device_a(), 0, GemmALeadDim(gemm), a_zero_point,
+                                    test.b_type, device_b(), 0, GemmBLeadDim(gemm), b_zero_point,
+                                    device_c(), 0, GemmCLeadDim(gemm), c_zero_point,
+                                    scale, test.scale_mode, device_scale(), 0,
+                                    &queue_plain, &event);
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    WaitForEvent(event);
+    const auto result = tester.CopyToHost(device_c, host_c.size());
+
+    // Computes the reference on the host: the integer GEMM of the dequantised values followed by
+    // the requantisation
+    auto host_a_int = std::vector<int>(host_a.size());
+    auto host_b_int = std::vector<int>(host_b.size());
+    const auto dequantise = [](const cl_uchar value, const QuantizedType type,
+                               const int zero_point) {
+      const auto is_unsigned = (type == QuantizedType::kUint8);
+      return ((is_unsigned) ? static_cast<int>(value) :
+                              static_cast<int>(static_cast<cl_char>(value))) - zero_point;
+    };
+    for (auto i = size_t{0}; i < host_a.size(); ++i) {
+      host_a_int[i] = dequantise(host_a[i], test.a_type, a_zero_point);
+    }
+    for (auto i = size_t{0}; i < host_b.size(); ++i) {
+      host_b_int[i] = dequantise(host_b[i], test.b_type, b_zero_point);
+    }
+    auto reference = std::vector<double>(host_c.size());
+    ReferenceGemm(gemm, 1.0, 0.0, host_a_int, 0, host_b_int, 0, reference, 0);
+    for (auto row = size_t{0}; row < gemm.m; ++row) {
+      for (auto col = size_t{0}; col < gemm.n; ++col) {
+        auto multiplier = scale;
+        if (test.scale_mode == EpilogueMode::kPerRow) { multiplier *= host_scale[row]; }
+        if (test.scale_mode == EpilogueMode::kPerColumn) { multiplier *= host_scale[col]; }
+        auto &value = reference[MatrixIndex(gemm.layout, row, col, GemmCLeadDim(gemm))];
+        value = ExpectedResult(T{0}, static_cast<int>(value), multiplier, c_zero_point);
+      }
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmInt8Tests<cl_int>(argc, argv, false, "GEMMINT8INT32", 0.0);
+  errors += clblast::RunGemmInt8Tests<float>(argc, argv, true, "GEMMINT8FLOAT", 1e-5);
+  errors += clblast::RunGemmInt8Tests<cl_char>(argc, argv, true, "GEMMINT8", 0.0);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,85 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the mixed-precision GemmMixed function, comparing against a
+// simple single-precision reference implementation on the host
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "test/correctness/misctester.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmMixedTests(int argc, char *argv[], const bool silent,
+                         const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  const auto alpha = 0.5f;
+  const auto beta = 2.0f;
+
+  // The test cases: multiples and non-multiples of the tile sizes with all layouts and transposes
+  const auto test_cases = std::vector<GemmTestCase>{
+    {64, 64, 64, Layout::kRowMajor, Transpose::kNo, Transpose::kNo},
+    {67, 33, 41, Layout::kRowMajor, Transpose::kYes, Transpose::kNo},
+    {67, 33, 41, Layout::kColMajor, Transpose::kNo, Transpose::kYes},
+    {129, 97, 300, Layout::kColMajor, Transpose::kYes, Transpose::kYes},
+    {256, 200, 512, Layout::kRowMajor, Transpose::kNo, Transpose::kYes},
+  };
+
+  fprintf(stdout, "* Testing GemmMixed for '%s'\n", routine_name.c_str());
+  for (const auto &test : test_cases) {
+
+    // Populate host matrices with some example data
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<half>(test.m * test.k, mt);
+    const auto host_b = RandomVector<half>(test.k * test.n, mt);
+    const auto host_c = RandomVector<T>(test.m * test.n, mt);
+
+    // Runs the routine
+    auto device_a = tester.CopyToDevice(host_a);
+    auto device_b = tester.CopyToDevice(host_b);
+    auto device_c = tester.CopyToDevice(host_c);
+    auto queue_plain = tester.queue()();
+    auto event = cl_event{nullptr};
+    const auto status = GemmMixed<T>(test.layout, test.a_transpose, test.b_transpose,
+                                     test.m, test.n, test.k, alpha,
+                                     device_a(), 0, GemmALeadDim(test),
+                                     device_b(), 0, GemmBLeadDim(test),
+                                     beta, device_c(), 0, GemmCLeadDim(test),
+                                     &queue_plain, &event);
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    WaitForEvent(event);
+    const auto result = tester.CopyToHost(device_c, host_c.size());
+
+    // Compares against the reference on the host
+    auto reference = ToDoubleVector(host_c);
+    ReferenceGemm(test, ToDouble(alpha), ToDouble(beta), host_a, 0, host_b, 0, reference, 0);
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmMixedTests<float>(argc, argv, false, "SGEMMMIXED", 1e-3);
+  errors += clblast::RunGemmMixedTests<clblast::half>(argc, argv, true, "HGEMMMIXED", 1e-2);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,95 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the split-K version of GEMM for small m and n but large k. It is
+// forced through the 'KernelSelectionSplitK' parameters, which are set such that a few tiles of C
+// never fill the device and such that a smaller k is already split. The k-dimension of the test
+// sizes is not a multiple of the tile size, such that the last part is smaller than the others. The
+// results are compared against a simple reference implementation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmSplitKTests(int argc, char *argv[], const bool silent,
+                          const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kGroupsPerUnit = size_t{1024};
+  constexpr auto kMinSize = size_t{128};
+  const auto alpha = static_cast<T>(1.5);
+  const auto beta = static_cast<T>(-0.5);
+
+  // The test cases: small m and n with a k-dimension of at least 512, with all layouts and
+  // transposes. The first case also serves to load the 'KernelSelectionSplitK' parameters in the
+  // cache.
+  const auto test_cases = std::vector<GemmTestCase>{
+    {16, 16, 512, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+    {32, 8, 1000, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+    {7, 33, 777, Layout::kRowMajor, Transpose::kNo, Transpose::kYes},
+    {64, 20, 2049, Layout::kColMajor, Transpose::kYes, Transpose::kNo},
+    {1, 50, 4100, Layout::kRowMajor, Transpose::kYes, Transpose::kYes},
+    {40, 1, 513, Layout::kColMajor, Transpose::kNo, Transpose::kYes},
+  };
+
+  fprintf(stdout, "* Testing the split-K version of GEMM for '%s'\n", routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id];
+
+    // Populate host matrices with some example data
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(test.m * test.k, mt);
+    const auto host_b = RandomVector<T>(test.k * test.n, mt);
+    const auto host_c = RandomVector<T>(test.m * test.n, mt);
+
+    // Forces the split-K version after the first (regular) run
+    if (test_id == 0) {
+      auto result = std::vector<T>();
+      if (RunGemm(tester, test, alpha, beta, host_a, host_b, host_c, result) !=
+          StatusCode::kSuccess) { tester.AddResult(false); break; }
+      const auto parameters = std::unordered_map<std::string,size_t>{
+        {"XGEMM_SPLITK_GROUPS_PER_UNIT", kGroupsPerUnit}, {"XGEMM_SPLITK_MIN_SIZE", kMinSize}
+      };
+      if (OverrideParameters(tester.device()(), "KernelSelectionSplitK", PrecisionValue<T>(),
+                             parameters) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+    }
+
+    // Runs the routine and compares against the reference
+    auto result = std::vector<T>();
+    if (RunGemm(tester, test, alpha, beta, host_a, host_b, host_c, result) !=
+        StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    auto reference = ToDoubleVector(host_c);
+    ReferenceGemm(test, ToDouble(alpha), ToDouble(beta), host_a, 0, host_b, 0, reference, 0);
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmSplitKTests<float>(argc, argv, false, "SGEMM", 1e-3);
+  errors += clblast::RunGemmSplitKTests<double>(argc, argv, true, "DGEMM", 1e-12);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
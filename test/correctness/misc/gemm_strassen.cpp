@@ -0,0 +1,98 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Strassen-Winograd version of GEMM in reduced-accuracy mode.
+// The cut-off size is lowered through the 'KernelSelectionStrassen' parameters, such that small
+// matrices already use one or two levels of recursion. The results are compared against a simple
+// reference implementation on the host using a norm-wise error bound.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmStrassenTests(int argc, char *argv[], const bool silent,
+                            const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kStrassenMinSize = size_t{64};
+  const auto alpha = static_cast<T>(1.5);
+  const auto beta = static_cast<T>(-0.5);
+
+  // The test cases: even and odd sizes with one or two levels of recursion and all layouts and
+  // transposes. The first case also serves to load the 'KernelSelectionStrassen' parameters in the
+  // cache.
+  const auto test_cases = std::vector<GemmTestCase>{
+    {128, 128, 128, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+    {257, 263, 270, Layout::kRowMajor, Transpose::kNo, Transpose::kYes},
+    {131, 97, 75, Layout::kColMajor, Transpose::kYes, Transpose::kNo},
+    {300, 200, 129, Layout::kRowMajor, Transpose::kYes, Transpose::kYes},
+    {64, 300, 65, Layout::kColMajor, Transpose::kNo, Transpose::kYes},
+  };
+
+  fprintf(stdout, "* Testing the Strassen-Winograd version of GEMM for '%s'\n",
+          routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id];
+
+    // Populate host matrices with some example data
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(test.m * test.k, mt);
+    const auto host_b = RandomVector<T>(test.k * test.n, mt);
+    const auto host_c = RandomVector<T>(test.m * test.n, mt);
+
+    // Lowers the cut-off size of the Strassen-Winograd version after the first (regular) run
+    if (test_id == 0) {
+      auto result = std::vector<T>();
+      if (RunGemm(tester, test, alpha, beta, host_a, host_b, host_c, result) !=
+          StatusCode::kSuccess) { tester.AddResult(false); break; }
+      const auto parameters = std::unordered_map<std::string,size_t>{
+        {"XGEMM_STRASSEN_MIN_SIZE", kStrassenMinSize}
+      };
+      if (OverrideParameters(tester.device()(), "KernelSelectionStrassen", PrecisionValue<T>(),
+                             parameters) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+    }
+
+    // Runs the routine in reduced-accuracy mode
+    SetAccuracy(Accuracy::kReduced);
+    auto result = std::vector<T>();
+    const auto status = RunGemm(tester, test, alpha, beta, host_a, host_b, host_c, result);
+    SetAccuracy(Accuracy::kFull);
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+
+    // Compares the results using a norm-wise error bound, Strassen-Winograd doesn't satisfy an
+    // element-wise bound
+    auto reference = ToDoubleVector(host_c);
+    ReferenceGemm(test, ToDouble(alpha), ToDouble(beta), host_a, 0, host_b, 0, reference, 0);
+    tester.AddResult(CompareResultsNormWise(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmStrassenTests<float>(argc, argv, false, "SGEMM", 1e-4);
+  errors += clblast::RunGemmStrassenTests<double>(argc, argv, true, "DGEMM", 1e-12);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
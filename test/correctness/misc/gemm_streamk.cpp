@@ -0,0 +1,103 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the stream-K version of the in-direct GEMM kernel. It is forced
+// through the 'KernelSelection' and 'KernelSelectionStreamK' parameters, which are set such that
+// the in-direct kernel is always used and such that stream-K is used for any number of waves. The
+// split-K version is disabled. The test sizes give various numbers of tiles, such that most of them
+// leave the last wave incomplete on any device with more than one compute unit. The results are
+// compared against a simple reference implementation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmStreamKTests(int argc, char *argv[], const bool silent,
+                           const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  const auto alpha = static_cast<T>(1.5);
+  const auto beta = static_cast<T>(-0.5);
+
+  // The test cases: different numbers of tiles and all layouts and transposes. The first case also
+  // serves to load the kernel-selection parameters in the cache.
+  const auto test_cases = std::vector<GemmTestCase>{
+    {128, 128, 128, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+    {192, 64, 300, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+    {320, 70, 257, Layout::kRowMajor, Transpose::kNo, Transpose::kYes},
+    {448, 130, 200, Layout::kColMajor, Transpose::kYes, Transpose::kNo},
+    {200, 300, 129, Layout::kRowMajor, Transpose::kYes, Transpose::kYes},
+    {1000, 90, 400, Layout::kColMajor, Transpose::kNo, Transpose::kYes},
+  };
+
+  fprintf(stdout, "* Testing the stream-K version of GEMM for '%s'\n", routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id];
+
+    // Populate host matrices with some example data
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(test.m * test.k, mt);
+    const auto host_b = RandomVector<T>(test.k * test.n, mt);
+    const auto host_c = RandomVector<T>(test.m * test.n, mt);
+
+    // Forces the in-direct stream-K version after the first (regular) run
+    if (test_id == 0) {
+      auto result = std::vector<T>();
+      if (RunGemm(tester, test, alpha, beta, host_a, host_b, host_c, result) !=
+          StatusCode::kSuccess) { tester.AddResult(false); break; }
+      const auto device = tester.device()();
+      const auto precision = PrecisionValue<T>();
+      const auto selection = std::unordered_map<std::string,size_t>{
+        {"XGEMM_MIN_INDIRECT_SIZE", 0}
+      };
+      const auto split_k = std::unordered_map<std::string,size_t>{
+        {"XGEMM_SPLITK_GROUPS_PER_UNIT", 0}, {"XGEMM_SPLITK_MIN_SIZE", 0}
+      };
+      const auto stream_k = std::unordered_map<std::string,size_t>{
+        {"XGEMM_STREAMK_MAX_WAVES", 1024}
+      };
+      if (OverrideParameters(device, "KernelSelection", precision, selection) !=
+          StatusCode::kSuccess ||
+          OverrideParameters(device, "KernelSelectionSplitK", precision, split_k) !=
+          StatusCode::kSuccess ||
+          OverrideParameters(device, "KernelSelectionStreamK", precision, stream_k) !=
+          StatusCode::kSuccess) { tester.AddResult(false); break; }
+    }
+
+    // Runs the routine and compares against the reference
+    auto result = std::vector<T>();
+    if (RunGemm(tester, test, alpha, beta, host_a, host_b, host_c, result) !=
+        StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    auto reference = ToDoubleVector(host_c);
+    ReferenceGemm(test, ToDouble(alpha), ToDouble(beta), host_a, 0, host_b, 0, reference, 0);
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmStreamKTests<float>(argc, argv, false, "SGEMM", 1e-3);
+  errors += clblast::RunGemmStreamKTests<double>(argc, argv, true, "DGEMM", 1e-12);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,315 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the OpenCL run-time of the Netlib CBLAS API: repeated calls
+// sharing the context and the staging buffers, pinned host arrays (including changes to the host
+// contents), aligned and unaligned host arrays (which are used directly on devices sharing memory
+// with the host) and the pipelined GEMM and GEMV for large sizes. It also checks that an invalid
+// leading dimension is reported with the proper status code for large sizes. The results are
+// compared against a simple reference implementation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+
+#include "test/correctness/misctester.hpp"
+#include "clblast_netlib_c.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single GEMM test: the sizes, layout, transpose arguments and beta. The columns of C
+// are checked with a certain step, such that large sizes remain quick to verify.
+struct NetlibGemmTestCase {
+  GemmTestCase gemm;
+  float beta;
+  size_t column_step;
+};
+
+// Host data with a given alignment of the first element: the offset is in elements on top of an
+// address aligned to kAlignment bytes, such that the host arrays can be made unaligned on purpose
+class HostArray {
+ public:
+  static constexpr size_t kAlignment = 4096;
+  HostArray(const size_t size, const size_t offset):
+      storage_(size + offset + kAlignment / sizeof(float)),
+      size_(size) {
+    const auto address = reinterpret_cast<uintptr_t>(storage_.data());
+    const auto aligned = (address + kAlignment - 1) / kAlignment * kAlignment;
+    data_ = reinterpret_cast<float*>(aligned) + offset;
+  }
+  float* data() { return data_; }
+  const float* data() const { return data_; }
+  size_t size() const { return size_; }
+  float &operator[](const size_t i) { return data_[i]; }
+  const float &operator[](const size_t i) const { return data_[i]; }
+  void Populate(std::mt19937 &mt, std::uniform_real_distribution<double> &dist) {
+    for (auto i = size_t{0}; i < size_; ++i) { data_[i] = static_cast<float>(dist(mt)); }
+  }
+ private:
+  std::vector<float> storage_;
+  float* data_;
+  size_t size_;
+};
+
+// Runs SGEMM through the Netlib API with the given host arrays
+void RunNetlibGemm(const NetlibGemmTestCase &test, const float alpha, const HostArray &a,
+                   const HostArray &b, HostArray &c, const size_t a_ld) {
+  const auto &gemm = test.gemm;
+  cblas_sgemm(static_cast<CLBlastLayout>(gemm.layout),
+              static_cast<CLBlastTranspose>(gemm.a_transpose),
+              static_cast<CLBlastTranspose>(gemm.b_transpose),
+              static_cast<int>(gemm.m), static_cast<int>(gemm.n), static_cast<int>(gemm.k), alpha,
+              a.data(), static_cast<int>(a_ld), b.data(), static_cast<int>(GemmBLeadDim(gemm)),
+              test.beta, c.data(), static_cast<int>(GemmCLeadDim(gemm)));
+}
+
+// Compares the result of SGEMM against a reference computed on the host in double precision for
+// the selected columns of C. The other columns are not checked.
+bool CheckNetlibGemm(const NetlibGemmTestCase &test, const float alpha, const HostArray &a,
+                     const HostArray &b, const HostArray &c_before, const HostArray &c_after,
+                     const double tolerance) {
+  const auto &gemm = test.gemm;
+  const auto index = [&](const size_t row, const size_t col, const size_t ld) {
+    return MatrixIndex(gemm.layout, row, col, ld);
+  };
+  const auto a_ld = GemmALeadDim(gemm);
+  const auto b_ld = GemmBLeadDim(gemm);
+  auto errors = size_t{0};
+  for (auto col = size_t{0}; col < gemm.n; col += test.column_step) {
+    for (auto row = size_t{0}; row < gemm.m; ++row) {
+      auto value = 0.0;
+      for (auto id = size_t{0}; id < gemm.k; ++id) {
+        const auto a_index = (gemm.a_transpose == Transpose::kNo) ? index(row, id, a_ld) :
+                                                                    index(id, row, a_ld);
+        const auto b_index = (gemm.b_transpose == Transpose::kNo) ? index(id, col, b_ld) :
+                                                                    index(col, id, b_ld);
+        value += static_cast<double>(a[a_index]) * static_cast<double>(b[b_index]);
+      }
+      const auto c_index = index(row, col, GemmCLeadDim(gemm));
+      auto reference = static_cast<double>(alpha) * value;
+      if (test.beta != 0.0f) { reference += test.beta * static_cast<double>(c_before[c_index]); }
+      const auto difference = std::fabs(static_cast<double>(c_after[c_index]) - reference);
+      if (!(difference <= tolerance * std::max(1.0, std::fabs(reference)))) { errors++; }
+    }
+  }
+  return (errors == 0);
+}
+
+// Runs and checks a single SGEMM. The host arrays are allocated with the given offset from an
+// aligned address. If beta is zero, C is filled with NaNs, since it should then not be read.
+bool TestNetlibGemm(const NetlibGemmTestCase &test, const size_t offset, const double tolerance) {
+  const auto &gemm = test.gemm;
+  auto a = HostArray(gemm.m * gemm.k, offset);
+  auto b = HostArray(gemm.k * gemm.n, offset);
+  auto c = HostArray(gemm.m * gemm.n, offset);
+  std::mt19937 mt(kMiscTestSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  a.Populate(mt, dist);
+  b.Populate(mt, dist);
+  c.Populate(mt, dist);
+  if (test.beta == 0.0f) {
+    for (auto i = size_t{0}; i < c.size(); ++i) { c[i] = std::numeric_limits<float>::quiet_NaN(); }
+  }
+  auto c_before = HostArray(c.size(), 0);
+  std::copy(c.data(), c.data() + c.size(), c_before.data());
+  const auto alpha = 1.5f;
+  RunNetlibGemm(test, alpha, a, b, c, GemmALeadDim(gemm));
+  return CheckNetlibGemm(test, alpha, a, b, c_before, c, tolerance);
+}
+
+// Runs and checks a single SGEMV: y := alpha * op(A) * x + beta * y
+bool TestNetlibGemv(const size_t m, const size_t n, const Layout layout,
+                    const Transpose a_transpose, const size_t x_inc, const size_t y_inc,
+                    const double tolerance) {
+  const auto a_ld = (layout == Layout::kRowMajor) ? n : m;
+  const auto x_length = (a_transpose == Transpose::kNo) ? n : m;
+  const auto y_length = (a_transpose == Transpose::kNo) ? m : n;
+  auto a = HostArray(m * n, 0);
+  auto x = HostArray(x_length * x_inc, 0);
+  auto y = HostArray(y_length * y_inc, 0);
+  std::mt19937 mt(kMiscTestSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  a.Populate(mt, dist);
+  x.Populate(mt, dist);
+  y.Populate(mt, dist);
+  auto y_before = HostArray(y.size(), 0);
+  std::copy(y.data(), y.data() + y.size(), y_before.data());
+  const auto alpha = 0.5f;
+  const auto beta = -1.5f;
+  cblas_sgemv(static_cast<CLBlastLayout>(layout), static_cast<CLBlastTranspose>(a_transpose),
+              static_cast<int>(m), static_cast<int>(n), alpha, a.data(), static_cast<int>(a_ld),
+              x.data(), static_cast<int>(x_inc), beta, y.data(), static_cast<int>(y_inc));
+
+  // Compares the results, including the elements in between the increments which should be left
+  // untouched
+  auto errors = size_t{0};
+  for (auto i = size_t{0}; i < y.size(); ++i) {
+    auto expected = static_cast<double>(y_before[i]);
+    if (i % y_inc == 0) {
+      const auto id_y = i / y_inc;
+      auto value = 0.0;
+      for (auto id_x = size_t{0}; id_x < x_length; ++id_x) {
+        const auto row = (a_transpose == Transpose::kNo) ? id_y : id_x;
+        const auto col = (a_transpose == Transpose::kNo) ? id_x : id_y;
+        const auto a_index = MatrixIndex(layout, row, col, a_ld);
+        value += static_cast<double>(a[a_index]) * static_cast<double>(x[id_x * x_inc]);
+      }
+      expected = alpha * value + beta * expected;
+    }
+    const auto difference = std::fabs(static_cast<double>(y[i]) - expected);
+    if (!(difference <= tolerance * std::max(1.0, std::fabs(expected)))) { errors++; }
+  }
+  return (errors == 0);
+}
+
+// Runs and checks SAXPY a couple of times on the same host arrays
+bool TestNetlibAxpy(const size_t n, const double tolerance) {
+  constexpr auto kRepeats = size_t{3};
+  auto x = HostArray(n, 0);
+  auto y = HostArray(n, 0);
+  std::mt19937 mt(kMiscTestSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  x.Populate(mt, dist);
+  y.Populate(mt, dist);
+  auto reference = std::vector<double>(y.data(), y.data() + n);
+  const auto alpha = 0.25f;
+  for (auto repeat = size_t{0}; repeat < kRepeats; ++repeat) {
+    cblas_saxpy(static_cast<int>(n), alpha, x.data(), 1, y.data(), 1);
+    for (auto i = size_t{0}; i < n; ++i) { reference[i] += alpha * static_cast<double>(x[i]); }
+  }
+  auto errors = size_t{0};
+  for (auto i = size_t{0}; i < n; ++i) {
+    const auto difference = std::fabs(static_cast<double>(y[i]) - reference[i]);
+    if (!(difference <= tolerance * std::max(1.0, std::fabs(reference[i])))) { errors++; }
+  }
+  return (errors == 0);
+}
+
+// Runs a sequence of SGEMMs with pinned A and B matrices, in between modifying the host contents
+// without notice (detected through the fingerprint) and with notice (through invalidation)
+bool TestNetlibPinned(const NetlibGemmTestCase &test, const double tolerance) {
+  const auto &gemm = test.gemm;
+  auto a = HostArray(gemm.m * gemm.k, 0);
+  auto b = HostArray(gemm.k * gemm.n, 0);
+  auto c = HostArray(gemm.m * gemm.n, 0);
+  auto c_before = HostArray(c.size(), 0);
+  std::mt19937 mt(kMiscTestSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  a.Populate(mt, dist);
+  b.Populate(mt, dist);
+  const auto alpha = 1.0f;
+  const auto run_and_check = [&]() {
+    c.Populate(mt, dist);
+    std::copy(c.data(), c.data() + c.size(), c_before.data());
+    RunNetlibGemm(test, alpha, a, b, c, GemmALeadDim(gemm));
+    return CheckNetlibGemm(test, alpha, a, b, c_before, c, tolerance);
+  };
+  CLBlastNetlibPin(a.data(), a.size() * sizeof(float));
+  CLBlastNetlibPin(b.data(), b.size() * sizeof(float));
+  auto passed = run_and_check();
+  passed = run_and_check() && passed; // re-uses the device copies
+  a[a.size() / 2] += 1.0f;
+  passed = run_and_check() && passed; // the changed contents of A should be detected
+  b.Populate(mt, dist);
+  CLBlastNetlibInvalidate(b.data());
+  passed = run_and_check() && passed; // B was invalidated explicitly
+  CLBlastNetlibUnpin(a.data());
+  CLBlastNetlibUnpin(b.data());
+  a.Populate(mt, dist);
+  passed = run_and_check() && passed; // A and B are copied as regular arrays again
+  return passed;
+}
+
+// Runs an SGEMM with a too small leading dimension of A, which should be reported as such
+bool TestNetlibInvalidLeadDim(const NetlibGemmTestCase &test) {
+  const auto &gemm = test.gemm;
+  auto a = HostArray(gemm.m * gemm.k, 0);
+  auto b = HostArray(gemm.k * gemm.n, 0);
+  auto c = HostArray(gemm.m * gemm.n, 0);
+  const auto expected = std::string{"CLBlast returned with error code "} +
+                        ToString(StatusCode::kInvalidLeadDimA);
+  try {
+    RunNetlibGemm(test, 1.0f, a, b, c, GemmALeadDim(gemm) - 1);
+  } catch (const std::runtime_error &e) {
+    return (std::string{e.what()} == expected);
+  }
+  return false;
+}
+
+// =================================================================================================
+
+size_t RunNetlibRuntimeTests(const double tolerance) {
+  auto statistics = MiscTestStatistics();
+  const auto count = [&](const bool passed) { statistics.AddResult(passed); };
+
+  // Repeated calls of different routines: these share the context, queue and staging buffers
+  fprintf(stdout, "* Testing the shared run-time of the Netlib API\n");
+  for (auto repeat = 0; repeat < 2; ++repeat) {
+    count(TestNetlibAxpy(1000, tolerance));
+    count(TestNetlibGemv(70, 33, Layout::kColMajor, Transpose::kNo, 1, 2, tolerance));
+    count(TestNetlibGemm({{64, 48, 33, Layout::kRowMajor, Transpose::kNo, Transpose::kNo},
+                          0.5f, 1}, 0, tolerance));
+    count(TestNetlibGemm({{100, 20, 70, Layout::kColMajor, Transpose::kYes, Transpose::kNo},
+                          -1.0f, 1}, 0, tolerance));
+  }
+
+  // Pinned host arrays
+  fprintf(stdout, "* Testing pinned host arrays in the Netlib API\n");
+  count(TestNetlibPinned({{200, 100, 150, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+                          0.5f, 1}, tolerance));
+  count(TestNetlibPinned({{90, 300, 128, Layout::kRowMajor, Transpose::kYes, Transpose::kYes},
+                          1.0f, 1}, tolerance));
+
+  // Aligned and unaligned host arrays: on devices sharing memory with the host, only the former
+  // are used directly (zero-copy), the latter are copied to staging buffers
+  fprintf(stdout, "* Testing aligned and unaligned host arrays in the Netlib API\n");
+  for (const auto offset : {size_t{0}, size_t{1}, size_t{3}}) {
+    count(TestNetlibGemm({{256, 128, 200, Layout::kColMajor, Transpose::kNo, Transpose::kYes},
+                          1.0f, 1}, offset, tolerance));
+    count(TestNetlibGemm({{130, 257, 64, Layout::kRowMajor, Transpose::kYes, Transpose::kNo},
+                          0.0f, 1}, offset, tolerance));
+  }
+
+  // Large sizes, which are pipelined on devices which don't share memory with the host. With a
+  // beta of zero, the C panels are not copied to the device.
+  fprintf(stdout, "* Testing the pipelined GEMM and GEMV of the Netlib API\n");
+  count(TestNetlibGemm({{64, 8192, 2048, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+                        0.5f, 61}, 0, tolerance));
+  count(TestNetlibGemm({{64, 8192, 2048, Layout::kColMajor, Transpose::kNo, Transpose::kNo},
+                        0.0f, 61}, 0, tolerance));
+  count(TestNetlibGemm({{80, 8000, 2000, Layout::kRowMajor, Transpose::kYes, Transpose::kYes},
+                        -1.0f, 53}, 0, tolerance));
+  count(TestNetlibGemv(5000, 5000, Layout::kColMajor, Transpose::kNo, 1, 1, tolerance));
+  count(TestNetlibGemv(5000, 5000, Layout::kRowMajor, Transpose::kYes, 2, 3, tolerance));
+  count(TestNetlibInvalidLeadDim({{64, 8192, 2048, Layout::kColMajor, Transpose::kNo,
+                                  Transpose::kNo}, 1.0f, 1}));
+  count(TestNetlibInvalidLeadDim({{64, 8192, 2048, Layout::kRowMajor, Transpose::kNo,
+                                  Transpose::kNo}, 1.0f, 1}));
+
+  return statistics.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main() {
+  const auto errors = clblast::RunNetlibRuntimeTests(1e-3);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
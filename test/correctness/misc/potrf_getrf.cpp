@@ -0,0 +1,359 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the blocked Cholesky (Potrf/Potrs) and LU (Getrf/Getrs)
+// factorisations and solvers. The factorisations are verified on the host by reconstructing the
+// matrix from its factors or by computing the residual of the solution, using norm-wise error
+// bounds. The reported positions of non-positive or zero pivots are tested as well.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <complex>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single Cholesky test: the sizes, layout and triangle
+struct PotrfTestCase {
+  size_t n;
+  size_t nrhs;
+  Layout layout;
+  Triangle triangle;
+};
+
+// Settings of a single LU test: the sizes, layout and transpose argument of the solver. The solver
+// is only tested in case there are right-hand sides.
+struct GetrfTestCase {
+  size_t m;
+  size_t n;
+  size_t nrhs;
+  Layout layout;
+  Transpose a_transpose;
+};
+
+// Converts values from double precision complex for the reference computations
+template <typename T> T FromComplex(const std::complex<double> value);
+template <> float FromComplex(const std::complex<double> value) {
+  return static_cast<float>(value.real());
+}
+template <> double FromComplex(const std::complex<double> value) { return value.real(); }
+template <> float2 FromComplex(const std::complex<double> value) {
+  return {static_cast<float>(value.real()), static_cast<float>(value.imag())};
+}
+template <> double2 FromComplex(const std::complex<double> value) { return value; }
+
+// Returns whether or not the data-type is complex
+template <typename T> bool IsComplexType() { return false; }
+template <> bool IsComplexType<float2>() { return true; }
+template <> bool IsComplexType<double2>() { return true; }
+
+// Returns a random matrix in double precision complex, with zero imaginary parts for real types
+template <typename T>
+std::vector<std::complex<double>> RandomMatrix(const size_t size, std::mt19937 &mt) {
+  const auto host = RandomVector<T>(size, mt);
+  auto result = std::vector<std::complex<double>>(size);
+  for (auto i = size_t{0}; i < size; ++i) { result[i] = ToComplex(host[i]); }
+  return result;
+}
+
+// Copies an m-by-n matrix with a leading dimension of m (stored column-wise) into the given layout
+template <typename T>
+std::vector<T> ToLayout(const std::vector<std::complex<double>> &matrix,
+                        const size_t m, const size_t n, const Layout layout) {
+  auto result = std::vector<T>(m * n);
+  for (auto row = size_t{0}; row < m; ++row) {
+    for (auto col = size_t{0}; col < n; ++col) {
+      const auto index = (layout == Layout::kRowMajor) ? row * n + col : col * m + row;
+      result[index] = FromComplex<T>(matrix[col * m + row]);
+    }
+  }
+  return result;
+}
+
+// The inverse of the above
+template <typename T>
+std::vector<std::complex<double>> FromLayout(const std::vector<T> &matrix,
+                                             const size_t m, const size_t n, const Layout layout) {
+  auto result = std::vector<std::complex<double>>(m * n);
+  for (auto row = size_t{0}; row < m; ++row) {
+    for (auto col = size_t{0}; col < n; ++col) {
+      const auto index = (layout == Layout::kRowMajor) ? row * n + col : col * m + row;
+      result[col * m + row] = ToComplex(matrix[index]);
+    }
+  }
+  return result;
+}
+
+// Returns the largest absolute value of a matrix
+double MaxAbs(const std::vector<std::complex<double>> &matrix) {
+  auto result = 0.0;
+  for (const auto &value : matrix) { result = std::max(result, std::abs(value)); }
+  return result;
+}
+
+// Tests the residual of the solution X of op(A) * X = B, with all matrices stored column-wise
+bool TestResidual(const std::vector<std::complex<double>> &a,
+                  const std::vector<std::complex<double>> &x,
+                  const std::vector<std::complex<double>> &b,
+                  const size_t n, const size_t nrhs, const Transpose a_transpose,
+                  const double tolerance) {
+  auto max_residual = 0.0;
+  for (auto row = size_t{0}; row < n; ++row) {
+    for (auto col = size_t{0}; col < nrhs; ++col) {
+      auto value = std::complex<double>{0.0, 0.0};
+      for (auto id = size_t{0}; id < n; ++id) {
+        auto a_value = (a_transpose == Transpose::kNo) ? a[id * n + row] : a[row * n + id];
+        if (a_transpose == Transpose::kConjugate) { a_value = std::conj(a_value); }
+        value += a_value * x[col * n + id];
+      }
+      max_residual = std::max(max_residual, std::abs(value - b[col * n + row]));
+    }
+  }
+  return max_residual <= tolerance * n * MaxAbs(a) * std::max(1.0, MaxAbs(x));
+}
+
+// =================================================================================================
+
+template <typename T>
+size_t RunPotrfTests(int argc, char *argv[], const bool silent,
+                     const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  if (!PrecisionSupported<T>(tester.device())) {
+    fprintf(stdout, "* Unsupported precision, skipping '%s'\n\n", routine_name.c_str());
+    return 0;
+  }
+  const auto &context = tester.context();
+  auto &queue = tester.queue();
+
+  // The test cases: single and multiple blocks with remainders, for all layouts and triangles
+  const auto test_cases = std::vector<PotrfTestCase>{
+    {200, 3, Layout::kColMajor, Triangle::kLower},
+    {130, 1, Layout::kRowMajor, Triangle::kUpper},
+    {64, 5, Layout::kColMajor, Triangle::kUpper},
+    {97, 4, Layout::kRowMajor, Triangle::kLower},
+    {1, 2, Layout::kColMajor, Triangle::kLower},
+  };
+
+  fprintf(stdout, "* Testing the blocked Cholesky factorisation and solver for '%s'\n",
+          routine_name.c_str());
+  for (const auto &test : test_cases) {
+    const auto n = test.n;
+    std::mt19937 mt(kMiscTestSeed);
+
+    // Creates a Hermitian positive-definite matrix A = M * M^H + n * I
+    const auto m_matrix = RandomMatrix<T>(n * n, mt);
+    auto a = std::vector<std::complex<double>>(n * n);
+    for (auto row = size_t{0}; row < n; ++row) {
+      for (auto col = size_t{0}; col < n; ++col) {
+        auto value = std::complex<double>{(row == col) ? static_cast<double>(n) : 0.0, 0.0};
+        for (auto id = size_t{0}; id < n; ++id) {
+          value += m_matrix[id * n + row] * std::conj(m_matrix[id * n + col]);
+        }
+        a[col * n + row] = value;
+      }
+    }
+    const auto b = RandomMatrix<T>(n * test.nrhs, mt);
+
+    // Factorises and solves on the device
+    const auto host_a = ToLayout<T>(a, n, n, test.layout);
+    const auto host_b = ToLayout<T>(b, n, test.nrhs, test.layout);
+    const auto b_ld = (test.layout == Layout::kRowMajor) ? test.nrhs : n;
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_b = Buffer<T>(context, host_b.size());
+    auto device_info = Buffer<unsigned int>(context, 1);
+    device_a.Write(queue, host_a.size(), host_a);
+    device_b.Write(queue, host_b.size(), host_b);
+    auto queue_plain = queue();
+    auto status = Potrf<T>(test.layout, test.triangle, n, device_a(), 0, n,
+                           device_info(), 0, &queue_plain);
+    if (status == StatusCode::kSuccess) {
+      status = Potrs<T>(test.layout, test.triangle, n, test.nrhs, device_a(), 0, n,
+                        device_b(), 0, b_ld, &queue_plain);
+    }
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    queue.Finish();
+    auto info = std::vector<unsigned int>(1);
+    auto result = std::vector<T>(host_b.size());
+    device_info.Read(queue, 1, info);
+    device_b.Read(queue, result.size(), result);
+
+    // Tests the residual of the solution
+    const auto x = FromLayout(result, n, test.nrhs, test.layout);
+    const auto is_valid = TestResidual(a, x, b, n, test.nrhs, Transpose::kNo, tolerance);
+    tester.AddResult(info[0] == 0 && is_valid);
+  }
+
+  // Tests the reported position of a non-positive pivot beyond the first block
+  {
+    const auto n = size_t{100};
+    constexpr auto kPivot = size_t{70};
+    auto a = std::vector<std::complex<double>>(n * n, {0.0, 0.0});
+    for (auto i = size_t{0}; i < n; ++i) { a[i * n + i] = (i == kPivot) ? -1.0 : 1.0; }
+    const auto host_a = ToLayout<T>(a, n, n, Layout::kColMajor);
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_info = Buffer<unsigned int>(context, 1);
+    device_a.Write(queue, host_a.size(), host_a);
+    auto queue_plain = queue();
+    const auto status = Potrf<T>(Layout::kColMajor, Triangle::kLower, n, device_a(), 0, n,
+                                 device_info(), 0, &queue_plain);
+    queue.Finish();
+    auto info = std::vector<unsigned int>(1);
+    device_info.Read(queue, 1, info);
+    tester.AddResult(status == StatusCode::kSuccess && info[0] == kPivot + 1);
+  }
+
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+
+template <typename T>
+size_t RunGetrfTests(int argc, char *argv[], const bool silent,
+                     const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  if (!PrecisionSupported<T>(tester.device())) {
+    fprintf(stdout, "* Unsupported precision, skipping '%s'\n\n", routine_name.c_str());
+    return 0;
+  }
+  const auto &context = tester.context();
+  auto &queue = tester.queue();
+
+  // The test cases: square and rectangular matrices with single and multiple blocks, all layouts
+  // and all transpose arguments of the solver
+  const auto conjugate = (IsComplexType<T>()) ? Transpose::kConjugate : Transpose::kYes;
+  const auto test_cases = std::vector<GetrfTestCase>{
+    {200, 200, 3, Layout::kColMajor, Transpose::kNo},
+    {130, 130, 2, Layout::kRowMajor, Transpose::kYes},
+    {97, 97, 1, Layout::kColMajor, conjugate},
+    {64, 64, 4, Layout::kRowMajor, Transpose::kNo},
+    {150, 97, 0, Layout::kRowMajor, Transpose::kNo},
+    {97, 150, 0, Layout::kColMajor, Transpose::kNo},
+  };
+
+  fprintf(stdout, "* Testing the blocked LU factorisation and solver for '%s'\n",
+          routine_name.c_str());
+  for (const auto &test : test_cases) {
+    const auto m = test.m;
+    const auto n = test.n;
+    const auto min_mn = std::min(m, n);
+    std::mt19937 mt(kMiscTestSeed);
+    const auto a = RandomMatrix<T>(m * n, mt);
+    const auto b = RandomMatrix<T>(n * test.nrhs, mt);
+
+    // Factorises on the device
+    const auto host_a = ToLayout<T>(a, m, n, test.layout);
+    const auto a_ld = (test.layout == Layout::kRowMajor) ? n : m;
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_ipiv = Buffer<unsigned int>(context, min_mn);
+    auto device_info = Buffer<unsigned int>(context, 1);
+    device_a.Write(queue, host_a.size(), host_a);
+    auto queue_plain = queue();
+    const auto status = Getrf<T>(test.layout, m, n, device_a(), 0, a_ld,
+                                 device_ipiv(), 0, device_info(), 0, &queue_plain);
+    if (status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+    queue.Finish();
+    auto info = std::vector<unsigned int>(1);
+    auto ipiv = std::vector<unsigned int>(min_mn);
+    auto result = std::vector<T>(host_a.size());
+    device_info.Read(queue, 1, info);
+    device_ipiv.Read(queue, min_mn, ipiv);
+    device_a.Read(queue, result.size(), result);
+    const auto lu = FromLayout(result, m, n, test.layout);
+
+    // Tests the factorisation by comparing P^T * A with L * U
+    auto pa = a;
+    auto is_valid = (info[0] == 0);
+    for (auto k = size_t{0}; k < min_mn && is_valid; ++k) {
+      if (ipiv[k] < k || ipiv[k] >= m) { is_valid = false; break; }
+      for (auto col = size_t{0}; col < n; ++col) {
+        std::swap(pa[col * m + k], pa[col * m + ipiv[k]]);
+      }
+    }
+    auto max_difference = 0.0;
+    for (auto row = size_t{0}; row < m && is_valid; ++row) {
+      for (auto col = size_t{0}; col < n; ++col) {
+        auto value = std::complex<double>{0.0, 0.0};
+        for (auto id = size_t{0}; id <= std::min(row, col) && id < min_mn; ++id) {
+          const auto l_value = (id == row) ? std::complex<double>{1.0, 0.0} : lu[id * m + row];
+          value += l_value * lu[col * m + id];
+        }
+        max_difference = std::max(max_difference, std::abs(value - pa[col * m + row]));
+      }
+    }
+    if (max_difference > tolerance * min_mn * MaxAbs(a)) { is_valid = false; }
+
+    // Tests the solver by computing the residual
+    if (is_valid && test.nrhs > 0) {
+      const auto host_b = ToLayout<T>(b, n, test.nrhs, test.layout);
+      const auto b_ld = (test.layout == Layout::kRowMajor) ? test.nrhs : n;
+      auto device_b = Buffer<T>(context, host_b.size());
+      device_b.Write(queue, host_b.size(), host_b);
+      const auto solve_status = Getrs<T>(test.layout, test.a_transpose, n, test.nrhs,
+                                         device_a(), 0, a_ld, device_ipiv(), 0,
+                                         device_b(), 0, b_ld, &queue_plain);
+      if (solve_status != StatusCode::kSuccess) { tester.AddResult(false); continue; }
+      queue.Finish();
+      auto solution = std::vector<T>(host_b.size());
+      device_b.Read(queue, solution.size(), solution);
+      const auto x = FromLayout(solution, n, test.nrhs, test.layout);
+      is_valid = TestResidual(a, x, b, n, test.nrhs, test.a_transpose, tolerance);
+    }
+    tester.AddResult(is_valid);
+  }
+
+  // Tests the reported position of a zero pivot beyond the first block
+  {
+    const auto n = size_t{100};
+    constexpr auto kPivot = size_t{70};
+    std::mt19937 mt(kMiscTestSeed);
+    auto a = RandomMatrix<T>(n * n, mt);
+    for (auto row = size_t{0}; row < n; ++row) { a[kPivot * n + row] = {0.0, 0.0}; }
+    const auto host_a = ToLayout<T>(a, n, n, Layout::kColMajor);
+    auto device_a = Buffer<T>(context, host_a.size());
+    auto device_ipiv = Buffer<unsigned int>(context, n);
+    auto device_info = Buffer<unsigned int>(context, 1);
+    device_a.Write(queue, host_a.size(), host_a);
+    auto queue_plain = queue();
+    const auto status = Getrf<T>(Layout::kColMajor, n, n, device_a(), 0, n,
+                                 device_ipiv(), 0, device_info(), 0, &queue_plain);
+    queue.Finish();
+    auto info = std::vector<unsigned int>(1);
+    device_info.Read(queue, 1, info);
+    tester.AddResult(status == StatusCode::kSuccess && info[0] == kPivot + 1);
+  }
+
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunPotrfTests<float>(argc, argv, false, "SPOTRF", 1e-5);
+  errors += clblast::RunPotrfTests<double>(argc, argv, true, "DPOTRF", 1e-12);
+  errors += clblast::RunPotrfTests<clblast::float2>(argc, argv, true, "CPOTRF", 1e-5);
+  errors += clblast::RunPotrfTests<clblast::double2>(argc, argv, true, "ZPOTRF", 1e-12);
+  errors += clblast::RunGetrfTests<float>(argc, argv, true, "SGETRF", 1e-5);
+  errors += clblast::RunGetrfTests<double>(argc, argv, true, "DGETRF", 1e-12);
+  errors += clblast::RunGetrfTests<clblast::float2>(argc, argv, true, "CGETRF", 1e-5);
+  errors += clblast::RunGetrfTests<clblast::double2>(argc, argv, true, "ZGETRF", 1e-12);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
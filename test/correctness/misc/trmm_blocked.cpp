@@ -0,0 +1,155 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the recursive version of TRMM, which splits the triangular
+// matrix in halves and updates B in-place with a GEMM on the off-diagonal part. The TRMM_BLOCK_SIZE
+// parameter is lowered, such that the test sizes need several levels of recursion. The results are
+// compared against a simple reference implementation on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single test: the sizes, the offset of A and the TRMM arguments
+struct TrmmBlockedTestCase {
+  size_t m;
+  size_t n;
+  size_t a_offset;
+  Layout layout;
+  Side side;
+  Triangle triangle;
+  Transpose a_transpose;
+  Diagonal diagonal;
+};
+
+// Runs a single TRMM and returns the result
+template <typename T>
+StatusCode RunTrmm(MiscTester &tester, const TrmmBlockedTestCase &test, const T alpha,
+                   const std::vector<T> &host_a, const std::vector<T> &host_b,
+                   std::vector<T> &result) {
+  const auto k = (test.side == Side::kLeft) ? test.m : test.n;
+  const auto b_ld = (test.layout == Layout::kRowMajor) ? test.n : test.m;
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_b = tester.CopyToDevice(host_b);
+  auto queue_plain = tester.queue()();
+  auto event = cl_event{nullptr};
+  const auto status = Trmm(test.layout, test.side, test.triangle, test.a_transpose, test.diagonal,
+                           test.m, test.n, alpha,
+                           device_a(), test.a_offset, k,
+                           device_b(), 0, b_ld,
+                           &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return status; }
+  WaitForEvent(event);
+  result = tester.CopyToHost(device_b, host_b.size());
+  return StatusCode::kSuccess;
+}
+
+template <typename T>
+size_t RunTrmmBlockedTests(int argc, char *argv[], const bool silent,
+                           const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kBlockSize = size_t{32};
+
+  // The test cases: triangular sizes above the lowered block size and above the default of 128,
+  // which are not a multiple of the block size, with all layouts, sides, triangles and transposes.
+  // The first case also serves to load the 'KernelSelectionTrmm' parameters in the cache.
+  const auto kUnit = Diagonal::kUnit;
+  const auto kNonUnit = Diagonal::kNonUnit;
+  const auto test_cases = std::vector<TrmmBlockedTestCase>{
+    {200, 40, 0, Layout::kColMajor, Side::kLeft, Triangle::kUpper, Transpose::kNo, kNonUnit},
+    {100, 70, 5, Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kNo, kUnit},
+    {300, 33, 3, Layout::kColMajor, Side::kLeft, Triangle::kUpper, Transpose::kYes, kNonUnit},
+    {50, 257, 0, Layout::kColMajor, Side::kRight, Triangle::kLower, Transpose::kNo, kNonUnit},
+    {65, 129, 7, Layout::kColMajor, Side::kRight, Triangle::kUpper, Transpose::kYes, kUnit},
+    {150, 60, 1, Layout::kRowMajor, Side::kLeft, Triangle::kLower, Transpose::kYes, kNonUnit},
+    {31, 140, 2, Layout::kRowMajor, Side::kRight, Triangle::kUpper, Transpose::kNo, kNonUnit},
+  };
+
+  fprintf(stdout, "* Testing the recursive version of '%s'\n", routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id];
+    const auto k = (test.side == Side::kLeft) ? test.m : test.n;
+    const auto b_ld = (test.layout == Layout::kRowMajor) ? test.n : test.m;
+
+    // Populate host data with some example data
+    std::mt19937 mt(kMiscTestSeed);
+    const auto host_a = RandomVector<T>(test.a_offset + k * k, mt);
+    const auto host_b = RandomVector<T>(test.m * test.n, mt);
+    const auto alpha = RandomVector<T>(1, mt)[0];
+
+    // Lowers the block size after the first (regular) run
+    if (test_id == 0) {
+      auto result = std::vector<T>();
+      if (RunTrmm(tester, test, alpha, host_a, host_b, result) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+      const auto parameters = std::unordered_map<std::string,size_t>{
+        {"TRMM_BLOCK_SIZE", kBlockSize}
+      };
+      if (OverrideParameters(tester.device()(), "KernelSelectionTrmm", PrecisionValue<T>(),
+                             parameters) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+    }
+
+    // Runs the routine
+    auto result = std::vector<T>();
+    if (RunTrmm(tester, test, alpha, host_a, host_b, result) != StatusCode::kSuccess) {
+      tester.AddResult(false); continue;
+    }
+
+    // Computes the reference on the host in double precision: the elements of op(A) outside of the
+    // triangle are zero and those on the diagonal are one for a unit diagonal
+    const auto op_a = [&](const size_t row, const size_t col) {
+      const auto r = (test.a_transpose == Transpose::kNo) ? row : col;
+      const auto c = (test.a_transpose == Transpose::kNo) ? col : row;
+      const auto in_triangle = (test.triangle == Triangle::kUpper) ? (r <= c) : (r >= c);
+      if (!in_triangle) { return 0.0; }
+      if (r == c && test.diagonal == Diagonal::kUnit) { return 1.0; }
+      return ToDouble(host_a[test.a_offset + MatrixIndex(test.layout, r, c, k)]);
+    };
+    const auto b = [&](const size_t row, const size_t col) {
+      return ToDouble(host_b[MatrixIndex(test.layout, row, col, b_ld)]);
+    };
+    auto reference = std::vector<double>(host_b.size());
+    for (auto row = size_t{0}; row < test.m; ++row) {
+      for (auto col = size_t{0}; col < test.n; ++col) {
+        auto value = 0.0;
+        for (auto id = size_t{0}; id < k; ++id) {
+          value += (test.side == Side::kLeft) ? op_a(row, id) * b(id, col) :
+                                                b(row, id) * op_a(id, col);
+        }
+        reference[MatrixIndex(test.layout, row, col, b_ld)] = ToDouble(alpha) * value;
+      }
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTrmmBlockedTests<float>(argc, argv, false, "STRMM", 1e-3);
+  errors += clblast::RunTrmmBlockedTests<double>(argc, argv, true, "DTRMM", 1e-10);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,186 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the recursive version of TRSM, which inverts the diagonal blocks
+// of the triangular matrix and solves the remainder through GEMM. The sizes are larger than the
+// TRSM_BLOCK_SIZE parameter, both for the default and for a lowered value, and the triangular
+// matrix is stored at an offset. The results are compared against a simple forward or backward
+// substitution on the host. Finally, an invalid block size is checked to be reported as such.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single test: the sizes, the offset of A and the TRSM arguments
+struct TrsmBlockedTestCase {
+  size_t m;
+  size_t n;
+  size_t a_offset;
+  Layout layout;
+  Side side;
+  Triangle triangle;
+  Transpose a_transpose;
+  Diagonal diagonal;
+};
+
+// Runs a single TRSM and returns the result
+template <typename T>
+StatusCode RunTrsm(MiscTester &tester, const TrsmBlockedTestCase &test, const T alpha,
+                   const std::vector<T> &host_a, const std::vector<T> &host_b,
+                   std::vector<T> &result) {
+  const auto k = (test.side == Side::kLeft) ? test.m : test.n;
+  const auto b_ld = (test.layout == Layout::kRowMajor) ? test.n : test.m;
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_b = tester.CopyToDevice(host_b);
+  auto queue_plain = tester.queue()();
+  auto event = cl_event{nullptr};
+  const auto status = Trsm(test.layout, test.side, test.triangle, test.a_transpose, test.diagonal,
+                           test.m, test.n, alpha,
+                           device_a(), test.a_offset, k,
+                           device_b(), 0, b_ld,
+                           &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return status; }
+  WaitForEvent(event);
+  result = tester.CopyToHost(device_b, host_b.size());
+  return StatusCode::kSuccess;
+}
+
+// Overrides the 'Invert' parameters with the given TRSM block size
+template <typename T>
+StatusCode SetTrsmBlockSize(MiscTester &tester, const size_t block_size) {
+  const auto parameters = std::unordered_map<std::string,size_t>{
+    {"INTERNAL_BLOCK_SIZE", 16}, {"TRSM_BLOCK_SIZE", block_size}
+  };
+  return OverrideParameters(tester.device()(), "Invert", PrecisionValue<T>(), parameters);
+}
+
+template <typename T>
+size_t RunTrsmBlockedTests(int argc, char *argv[], const bool silent,
+                           const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kBlockSize = size_t{32};
+  constexpr auto kInvalidBlockSize = size_t{24};
+
+  // The test cases: triangular sizes above the default block size of 64, which are not a multiple
+  // of the block size, with all layouts, sides, triangles and transposes. The first two cases run
+  // with the default block size, after which it is lowered for the others. The first case also
+  // serves to load the 'Invert' parameters in the cache.
+  const auto kUnit = Diagonal::kUnit;
+  const auto kNonUnit = Diagonal::kNonUnit;
+  const auto test_cases = std::vector<TrsmBlockedTestCase>{
+    {200, 40, 3, Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kNo, kNonUnit},
+    {70, 150, 5, Layout::kRowMajor, Side::kRight, Triangle::kUpper, Transpose::kYes, kNonUnit},
+    {100, 70, 5, Layout::kColMajor, Side::kLeft, Triangle::kUpper, Transpose::kNo, kUnit},
+    {129, 33, 1, Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kYes, kNonUnit},
+    {50, 257, 7, Layout::kColMajor, Side::kRight, Triangle::kLower, Transpose::kNo, kNonUnit},
+    {65, 97, 2, Layout::kColMajor, Side::kRight, Triangle::kUpper, Transpose::kNo, kUnit},
+    {150, 60, 9, Layout::kRowMajor, Side::kLeft, Triangle::kUpper, Transpose::kYes, kNonUnit},
+  };
+
+  fprintf(stdout, "* Testing the recursive version of '%s'\n", routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id];
+    const auto k = (test.side == Side::kLeft) ? test.m : test.n;
+    const auto b_ld = (test.layout == Layout::kRowMajor) ? test.n : test.m;
+
+    // Populate host data with some example data. The off-diagonal elements are scaled down and the
+    // diagonal is made dominant, such that the system is well-conditioned also for the larger sizes
+    // and with a unit diagonal.
+    std::mt19937 mt(kMiscTestSeed);
+    auto host_a = RandomVector<T>(test.a_offset + k * k, mt);
+    const auto host_b = RandomVector<T>(test.m * test.n, mt);
+    for (auto i = size_t{0}; i < k * k; ++i) {
+      const auto is_diagonal = (i % (k + 1) == 0);
+      const auto value = host_a[test.a_offset + i];
+      host_a[test.a_offset + i] = (is_diagonal) ? value + static_cast<T>(4.0) :
+                                                  value / static_cast<T>(k);
+    }
+    const auto alpha = RandomVector<T>(1, mt)[0];
+
+    // Runs the routine
+    auto result = std::vector<T>();
+    if (RunTrsm(tester, test, alpha, host_a, host_b, result) != StatusCode::kSuccess) {
+      tester.AddResult(false); continue;
+    }
+
+    // Lowers the block size after the cases with the default value
+    if (test_id == 1 && SetTrsmBlockSize<T>(tester, kBlockSize) != StatusCode::kSuccess) {
+      tester.AddResult(false); break;
+    }
+
+    // Computes the reference on the host in double precision. Each column (left) or row (right) of
+    // B is solved as a separate system with the matrix 'sys', which is op(A) on the left-hand side
+    // and its transpose on the right-hand side. It is lower triangular when 'forward' is set, in
+    // which case the system is solved from first to last.
+    const auto is_a_transposed = ((test.a_transpose == Transpose::kNo) ==
+                                  (test.side == Side::kRight));
+    const auto sys = [&](const size_t row, const size_t col) {
+      const auto r = (is_a_transposed) ? col : row;
+      const auto c = (is_a_transposed) ? row : col;
+      return ToDouble(host_a[test.a_offset + MatrixIndex(test.layout, r, c, k)]);
+    };
+    const auto is_op_lower = ((test.triangle == Triangle::kLower) ==
+                              (test.a_transpose == Transpose::kNo));
+    const auto forward = (test.side == Side::kLeft) ? is_op_lower : !is_op_lower;
+    const auto num_systems = (test.side == Side::kLeft) ? test.n : test.m;
+    const auto b_index = [&](const size_t system, const size_t i) {
+      return (test.side == Side::kLeft) ? MatrixIndex(test.layout, i, system, b_ld) :
+                                          MatrixIndex(test.layout, system, i, b_ld);
+    };
+    auto reference = std::vector<double>(host_b.size());
+    for (auto system = size_t{0}; system < num_systems; ++system) {
+      for (auto step = size_t{0}; step < k; ++step) {
+        const auto i = (forward) ? step : k - 1 - step;
+        auto value = ToDouble(alpha) * ToDouble(host_b[b_index(system, i)]);
+        for (auto j = size_t{0}; j < k; ++j) {
+          const auto is_solved = (forward) ? (j < i) : (j > i);
+          if (is_solved) { value -= sys(i, j) * reference[b_index(system, j)]; }
+        }
+        reference[b_index(system, i)] = (test.diagonal == Diagonal::kUnit) ? value :
+                                                                               value / sys(i, i);
+      }
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+
+  // Checks that a block size which is not supported by the inversion kernels is reported as such
+  if (SetTrsmBlockSize<T>(tester, kInvalidBlockSize) != StatusCode::kSuccess) {
+    tester.AddResult(false);
+  }
+  else {
+    const auto &test = test_cases[0];
+    const auto host_a = std::vector<T>(test.a_offset + test.m * test.m, static_cast<T>(1.0));
+    const auto host_b = std::vector<T>(test.m * test.n, static_cast<T>(1.0));
+    auto result = std::vector<T>();
+    const auto status = RunTrsm(tester, test, static_cast<T>(1.0), host_a, host_b, result);
+    tester.AddResult(status == StatusCode::kInvalidLocalThreadsTotal);
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTrsmBlockedTests<float>(argc, argv, false, "STRSM", 1e-3);
+  errors += clblast::RunTrsmBlockedTests<double>(argc, argv, true, "DTRSM", 1e-10);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
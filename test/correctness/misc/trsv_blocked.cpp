@@ -0,0 +1,151 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the two versions of TRSV: the single-kernel version for small
+// systems and the block-algorithm chained through events for larger ones. The TRSV_SINGLE_MAX
+// parameter is lowered, such that the test sizes fall on both sides of it. The results are compared
+// against a simple forward or backward substitution on the host.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "test/correctness/misctester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Settings of a single test: the size, offsets and the TRSV arguments
+struct TrsvBlockedTestCase {
+  size_t n;
+  size_t a_offset;
+  size_t x_offset;
+  size_t x_inc;
+  Layout layout;
+  Triangle triangle;
+  Transpose a_transpose;
+  Diagonal diagonal;
+};
+
+// Runs a single TRSV and returns the result
+template <typename T>
+StatusCode RunTrsv(MiscTester &tester, const TrsvBlockedTestCase &test,
+                   const std::vector<T> &host_a, const std::vector<T> &host_x,
+                   std::vector<T> &result) {
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_x = tester.CopyToDevice(host_x);
+  auto queue_plain = tester.queue()();
+  auto event = cl_event{nullptr};
+  const auto status = Trsv<T>(test.layout, test.triangle, test.a_transpose, test.diagonal, test.n,
+                              device_a(), test.a_offset, test.n,
+                              device_x(), test.x_offset, test.x_inc,
+                              &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return status; }
+  WaitForEvent(event);
+  result = tester.CopyToHost(device_x, host_x.size());
+  return StatusCode::kSuccess;
+}
+
+template <typename T>
+size_t RunTrsvBlockedTests(int argc, char *argv[], const bool silent,
+                           const std::string &routine_name, const double tolerance) {
+  auto tester = MiscTester(argc, argv, silent);
+  constexpr auto kSingleMax = size_t{64};
+
+  // The test cases: sizes below and above the lowered TRSV_SINGLE_MAX, which are not a multiple of
+  // the block size, with all layouts, triangles and transposes. The first case also serves to load
+  // the 'Xtrsv' parameters in the cache.
+  const auto test_cases = std::vector<TrsvBlockedTestCase>{
+    {50, 0, 0, 1, Layout::kColMajor, Triangle::kLower, Transpose::kNo, Diagonal::kNonUnit},
+    {200, 3, 0, 1, Layout::kColMajor, Triangle::kUpper, Transpose::kNo, Diagonal::kNonUnit},
+    {333, 0, 5, 2, Layout::kRowMajor, Triangle::kLower, Transpose::kYes, Diagonal::kUnit},
+    {257, 7, 1, 1, Layout::kRowMajor, Triangle::kUpper, Transpose::kNo, Diagonal::kNonUnit},
+    {129, 0, 0, 3, Layout::kColMajor, Triangle::kUpper, Transpose::kYes, Diagonal::kUnit},
+  };
+
+  fprintf(stdout, "* Testing the single-kernel and blocked versions of '%s'\n",
+          routine_name.c_str());
+  for (auto test_id = size_t{0}; test_id < test_cases.size(); ++test_id) {
+    const auto &test = test_cases[test_id];
+
+    // Populate host data with some example data. The off-diagonal elements are scaled down and the
+    // diagonal is made dominant, such that the system is well-conditioned also for the larger sizes
+    // and with a unit diagonal.
+    std::mt19937 mt(kMiscTestSeed);
+    auto host_a = RandomVector<T>(test.a_offset + test.n * test.n, mt);
+    const auto host_x = RandomVector<T>(test.x_offset + test.n * test.x_inc, mt);
+    for (auto i = size_t{0}; i < test.n * test.n; ++i) {
+      const auto is_diagonal = (i % (test.n + 1) == 0);
+      const auto value = host_a[test.a_offset + i];
+      host_a[test.a_offset + i] = (is_diagonal) ? value + static_cast<T>(4.0) :
+                                                  value / static_cast<T>(test.n);
+    }
+
+    // Lowers the maximum size of the single-kernel version after the first (regular) run
+    if (test_id == 0) {
+      auto result = std::vector<T>();
+      if (RunTrsv(tester, test, host_a, host_x, result) != StatusCode::kSuccess) {
+        tester.AddResult(false); break;
+      }
+      const auto parameters = std::unordered_map<std::string,size_t>{
+        {"TRSV_BLOCK_SIZE", 32}, {"TRSV_SINGLE_MAX", kSingleMax}
+      };
+      if (OverrideParameters(tester.device()(), "Xtrsv", PrecisionValue<T>(), parameters) !=
+          StatusCode::kSuccess) { tester.AddResult(false); break; }
+    }
+
+    // Runs the routine
+    auto result = std::vector<T>();
+    if (RunTrsv(tester, test, host_a, host_x, result) != StatusCode::kSuccess) {
+      tester.AddResult(false); continue;
+    }
+
+    // Computes the reference on the host in double precision: op(A) is lower triangular when
+    // 'forward' is set, in which case the system is solved from first to last. The elements in
+    // between the increments should be left untouched.
+    const auto op_a = [&](const size_t row, const size_t col) {
+      const auto r = (test.a_transpose == Transpose::kNo) ? row : col;
+      const auto c = (test.a_transpose == Transpose::kNo) ? col : row;
+      return ToDouble(host_a[test.a_offset + MatrixIndex(test.layout, r, c, test.n)]);
+    };
+    const auto forward = ((test.triangle == Triangle::kLower) ==
+                          (test.a_transpose == Transpose::kNo));
+    auto reference = ToDoubleVector(host_x);
+    const auto x = [&](const size_t i) -> double& {
+      return reference[test.x_offset + i * test.x_inc];
+    };
+    for (auto step = size_t{0}; step < test.n; ++step) {
+      const auto i = (forward) ? step : test.n - 1 - step;
+      auto value = x(i);
+      for (auto j = size_t{0}; j < test.n; ++j) {
+        const auto is_solved = (forward) ? (j < i) : (j > i);
+        if (is_solved) { value -= op_a(i, j) * x(j); }
+      }
+      x(i) = (test.diagonal == Diagonal::kUnit) ? value : value / op_a(i, i);
+    }
+    tester.AddResult(CompareResults(result, reference, tolerance));
+  }
+  return tester.PrintStatistics();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTrsvBlockedTests<float>(argc, argv, false, "STRSV", 1e-3);
+  errors += clblast::RunTrsvBlockedTests<double>(argc, argv, true, "DTRSV", 1e-10);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,260 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the parts shared by the miscellaneous tests: the MiscTester class to set-up
+// OpenCL and to keep the test statistics, functions to create and copy test data, a reference GEMM
+// on the host, and functions to compare results against a reference in double precision.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_CORRECTNESS_MISCTESTER_H_
+#define CLBLAST_TEST_CORRECTNESS_MISCTESTER_H_
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Fixed seed for the random test data, for reproducibility
+constexpr auto kMiscTestSeed = 42;
+
+// Keeps track of the number of passed and failed tests
+class MiscTestStatistics {
+ public:
+
+  // Adds the result of a single test
+  void AddResult(const bool passed) {
+    if (passed) { passed_++; } else { errors_++; }
+  }
+
+  // Prints the statistics and returns the number of failed tests
+  size_t PrintStatistics() const {
+    fprintf(stdout, "    %zu test(s) passed\n", passed_);
+    fprintf(stdout, "    %zu test(s) failed\n", errors_);
+    fprintf(stdout, "\n");
+    return errors_;
+  }
+
+ private:
+  size_t passed_ = 0;
+  size_t errors_ = 0;
+};
+
+// Initializes OpenCL for the platform and device given on the command-line or through the
+// environment, and keeps the test statistics
+class MiscTester: public MiscTestStatistics {
+ public:
+
+  // Retrieves the arguments and prints the help message unless silent
+  MiscTester(int argc, char *argv[], const bool silent):
+      arguments_(RetrieveCommandLineArguments(argc, argv)),
+      help_("Options given/available:\n"),
+      platform_(Platform(GetArgument(arguments_, help_, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0})))),
+      device_(Device(platform_, GetArgument(arguments_, help_, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0})))),
+      context_(Context(device_)),
+      queue_(Queue(context_, device_)) {
+    if (!silent) { fprintf(stdout, "\n* %s\n", help_.c_str()); }
+  }
+
+  // Accessors to the OpenCL objects
+  const Platform& platform() const { return platform_; }
+  const Device& device() const { return device_; }
+  const Context& context() const { return context_; }
+  Queue& queue() { return queue_; }
+
+  // Creates a device buffer with a copy of the host data
+  template <typename T>
+  Buffer<T> CopyToDevice(const std::vector<T> &host) {
+    auto buffer = Buffer<T>(context_, host.size());
+    buffer.Write(queue_, host.size(), host);
+    return buffer;
+  }
+
+  // Copies the first elements of a device buffer back to the host
+  template <typename T>
+  std::vector<T> CopyToHost(const Buffer<T> &buffer, const size_t size) {
+    auto host = std::vector<T>(size);
+    buffer.Read(queue_, size, host);
+    return host;
+  }
+
+ private:
+  const std::vector<std::string> arguments_;
+  std::string help_;
+  const Platform platform_;
+  const Device device_;
+  const Context context_;
+  Queue queue_;
+};
+
+// Waits for the event of a routine to complete and releases it
+inline void WaitForEvent(cl_event event) {
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+}
+
+// =================================================================================================
+
+// Returns a vector of random test data, within the same range as for the regular tests
+template <typename T>
+std::vector<T> RandomVector(const size_t size, std::mt19937 &mt) {
+  auto host = std::vector<T>(size);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host, mt, dist);
+  return host;
+}
+
+// Converts values to double precision (complex) for the reference computations on the host
+template <typename T>
+double ToDouble(const T value) { return static_cast<double>(value); }
+inline double ToDouble(const half value) { return static_cast<double>(HalfToFloat(value)); }
+inline std::complex<double> ToComplex(const float value) { return {value, 0.0}; }
+inline std::complex<double> ToComplex(const double value) { return {value, 0.0}; }
+inline std::complex<double> ToComplex(const float2 value) { return {value.real(), value.imag()}; }
+inline std::complex<double> ToComplex(const double2 value) { return {value.real(), value.imag()}; }
+
+// Returns the index of element (row, col) of a matrix with leading dimension 'ld'
+inline size_t MatrixIndex(const Layout layout, const size_t row, const size_t col,
+                          const size_t ld) {
+  return (layout == Layout::kRowMajor) ? row * ld + col : col * ld + row;
+}
+
+// =================================================================================================
+
+// Settings of a single GEMM test: the sizes, layout and transpose arguments. The matrices are
+// stored without padding, such that the leading dimensions follow from the sizes.
+struct GemmTestCase {
+  size_t m;
+  size_t n;
+  size_t k;
+  Layout layout;
+  Transpose a_transpose;
+  Transpose b_transpose;
+};
+inline size_t GemmALeadDim(const GemmTestCase &test) {
+  const auto is_row_major = (test.layout == Layout::kRowMajor);
+  return (is_row_major == (test.a_transpose == Transpose::kNo)) ? test.k : test.m;
+}
+inline size_t GemmBLeadDim(const GemmTestCase &test) {
+  const auto is_row_major = (test.layout == Layout::kRowMajor);
+  return (is_row_major == (test.b_transpose == Transpose::kNo)) ? test.n : test.k;
+}
+inline size_t GemmCLeadDim(const GemmTestCase &test) {
+  return (test.layout == Layout::kRowMajor) ? test.n : test.m;
+}
+
+// Runs a single GEMM on the device and returns the resulting C matrix
+template <typename T>
+StatusCode RunGemm(MiscTester &tester, const GemmTestCase &test, const T alpha, const T beta,
+                   const std::vector<T> &host_a, const std::vector<T> &host_b,
+                   const std::vector<T> &host_c, std::vector<T> &result) {
+  auto device_a = tester.CopyToDevice(host_a);
+  auto device_b = tester.CopyToDevice(host_b);
+  auto device_c = tester.CopyToDevice(host_c);
+  auto queue_plain = tester.queue()();
+  auto event = cl_event{nullptr};
+  const auto status = Gemm(test.layout, test.a_transpose, test.b_transpose,
+                           test.m, test.n, test.k, alpha,
+                           device_a(), 0, GemmALeadDim(test), device_b(), 0, GemmBLeadDim(test),
+                           beta, device_c(), 0, GemmCLeadDim(test),
+                           &queue_plain, &event);
+  if (status != StatusCode::kSuccess) { return status; }
+  WaitForEvent(event);
+  result = tester.CopyToHost(device_c, host_c.size());
+  return StatusCode::kSuccess;
+}
+
+// Computes C := alpha * op(A) * op(B) + beta * C on the host in double precision, for matrices
+// starting at the given offsets. The reference C matrix has to be initialized with the original
+// values of C.
+template <typename T>
+void ReferenceGemm(const GemmTestCase &test, const double alpha, const double beta,
+                   const std::vector<T> &host_a, const size_t a_offset,
+                   const std::vector<T> &host_b, const size_t b_offset,
+                   std::vector<double> &reference, const size_t c_offset) {
+  const auto a_ld = GemmALeadDim(test);
+  const auto b_ld = GemmBLeadDim(test);
+  const auto c_ld = GemmCLeadDim(test);
+  for (auto row = size_t{0}; row < test.m; ++row) {
+    for (auto col = size_t{0}; col < test.n; ++col) {
+      auto value = 0.0;
+      for (auto id = size_t{0}; id < test.k; ++id) {
+        const auto a_index = (test.a_transpose == Transpose::kNo) ?
+                             MatrixIndex(test.layout, row, id, a_ld) :
+                             MatrixIndex(test.layout, id, row, a_ld);
+        const auto b_index = (test.b_transpose == Transpose::kNo) ?
+                             MatrixIndex(test.layout, id, col, b_ld) :
+                             MatrixIndex(test.layout, col, id, b_ld);
+        value += ToDouble(host_a[a_offset + a_index]) * ToDouble(host_b[b_offset + b_index]);
+      }
+      const auto c_index = c_offset + MatrixIndex(test.layout, row, col, c_ld);
+      reference[c_index] = alpha * value + beta * reference[c_index];
+    }
+  }
+}
+
+// =================================================================================================
+
+// Returns a copy of a vector in double precision, e.g. to initialize a reference result
+template <typename T>
+std::vector<double> ToDoubleVector(const std::vector<T> &host) {
+  auto result = std::vector<double>(host.size());
+  for (auto i = size_t{0}; i < host.size(); ++i) { result[i] = ToDouble(host[i]); }
+  return result;
+}
+
+// Compares a result against a reference element-wise, with a relative error bound for values
+// larger than one and an absolute bound otherwise. Also fails for NaN results.
+template <typename T>
+bool CompareResults(const std::vector<T> &result, const std::vector<double> &reference,
+                    const double tolerance) {
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    const auto difference = std::fabs(ToDouble(result[i]) - reference[i]);
+    if (!(difference <= tolerance * std::max(1.0, std::fabs(reference[i])))) { return false; }
+  }
+  return true;
+}
+
+// As above, but for complex results
+template <typename T>
+bool CompareResults(const std::vector<T> &result,
+                    const std::vector<std::complex<double>> &reference, const double tolerance) {
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    const auto difference = std::abs(ToComplex(result[i]) - reference[i]);
+    if (!(difference <= tolerance * std::max(1.0, std::abs(reference[i])))) { return false; }
+  }
+  return true;
+}
+
+// As above, but with a norm-wise error bound relative to the largest value of the reference
+template <typename T>
+bool CompareResultsNormWise(const std::vector<T> &result, const std::vector<double> &reference,
+                            const double tolerance) {
+  auto max_value = 0.0;
+  for (const auto value : reference) { max_value = std::max(max_value, std::fabs(value)); }
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    const auto difference = std::fabs(ToDouble(result[i]) - reference[i]);
+    if (!(difference <= tolerance * std::max(1.0, max_value))) { return false; }
+  }
+  return true;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_CORRECTNESS_MISCTESTER_H_
+#endif
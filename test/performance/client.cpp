@@ -132,6 +132,7 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
   args.silent         = CheckArgument(command_line_args, help, kArgQuiet);
   args.no_abbrv       = CheckArgument(command_line_args, help, kArgNoAbbreviations);
   warm_up_            = CheckArgument(command_line_args, help, kArgWarmUp);
+  reduced_accuracy_   = CheckArgument(command_line_args, help, kArgReducedAccuracy);
 
   // Prints the chosen (or defaulted) arguments to screen. This also serves as the help message,
   // which is thus always displayed (unless silence is specified).
@@ -167,6 +168,48 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
 
 // =================================================================================================
 
+namespace {
+
+// Computes the largest absolute difference between the elements of two results relative to the
+// largest absolute value of the reference result, i.e. a norm-wise relative error
+template <typename T>
+double RelativeError(const std::vector<T> &reference, const std::vector<T> &result) {
+  auto max_difference = 0.0;
+  auto max_value = 0.0;
+  for (auto i = size_t{0}; i < reference.size(); ++i) {
+    const auto difference = static_cast<double>(AbsoluteValue(result[i] - reference[i]));
+    max_difference = std::max(max_difference, difference);
+    max_value = std::max(max_value, static_cast<double>(AbsoluteValue(reference[i])));
+  }
+  return (max_value != 0.0) ? max_difference / max_value : max_difference;
+}
+template <>
+double RelativeError(const std::vector<half> &reference, const std::vector<half> &result) {
+  return RelativeError(HalfToFloatBuffer(reference), HalfToFloatBuffer(result));
+}
+
+// As above, but the largest error of all the given output buffers
+template <typename T>
+double OutputError(const BuffersHost<T> &ref, const BuffersHost<T> &res,
+                   const std::vector<std::string> &names) {
+  auto error = 0.0;
+  for (auto &name: names) {
+    if (name == kBufVecX) { error = std::max(error, RelativeError(ref.x_vec, res.x_vec)); }
+    else if (name == kBufVecY) { error = std::max(error, RelativeError(ref.y_vec, res.y_vec)); }
+    else if (name == kBufMatA) { error = std::max(error, RelativeError(ref.a_mat, res.a_mat)); }
+    else if (name == kBufMatB) { error = std::max(error, RelativeError(ref.b_mat, res.b_mat)); }
+    else if (name == kBufMatC) { error = std::max(error, RelativeError(ref.c_mat, res.c_mat)); }
+    else if (name == kBufMatAP) { error = std::max(error, RelativeError(ref.ap_mat, res.ap_mat)); }
+    else if (name == kBufScalar) { error = std::max(error, RelativeError(ref.scalar, res.scalar)); }
+    else { throw std::runtime_error("Invalid buffer name"); }
+  }
+  return error;
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
 // This is main performance tester
 template <typename T, typename U>
 void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes) {
@@ -254,8 +297,32 @@ void Client<T,U>::PerformanceTest(Arguments<U> &args, const SetMetric set_sizes)
       timings.push_back(std::pair<std::string, double>("cuBLAS", ms_cublas));
     }
 
+    // Runs CLBlast again in reduced-accuracy mode and computes the norm-wise relative error of its
+    // results compared to those of the regular mode, both computed from the original input data
+    auto reduced_error = 0.0;
+    if (reduced_accuracy_) {
+      SetAccuracy(Accuracy::kReduced);
+      auto ms_reduced = TimedExecution(args.num_runs, args, buffers, queue, run_routine_,
+                                       "CLBlast");
+      SetAccuracy(Accuracy::kFull);
+      auto buffers_source = BuffersHost<T>{x_source, y_source, a_source, b_source, c_source,
+                                           ap_source, scalar_source};
+      auto results_full = BuffersHost<T>();
+      auto results_reduced = BuffersHost<T>();
+      HostToDevice(args, buffers, buffers_source, queue, buffers_out_);
+      RunOnce(args, buffers, queue);
+      DeviceToHost(args, buffers, results_full, queue, buffers_out_);
+      SetAccuracy(Accuracy::kReduced);
+      HostToDevice(args, buffers, buffers_source, queue, buffers_out_);
+      RunOnce(args, buffers, queue);
+      DeviceToHost(args, buffers, results_reduced, queue, buffers_out_);
+      SetAccuracy(Accuracy::kFull);
+      reduced_error = OutputError(results_full, results_reduced, buffers_out_);
+      timings.push_back(std::pair<std::string, double>("CLBlast reduced", ms_reduced));
+    }
+
     // Prints the performance of the tested libraries
-    PrintTableRow(args, timings);
+    PrintTableRow(args, timings, reduced_error);
 
     // Makes the jump to the next step
     ++s;
@@ -319,6 +386,18 @@ double Client<T,U>::TimedExecution(const size_t num_runs, const Arguments<U> &ar
   return *std::min_element(timings.begin(), timings.end());
 }
 
+// Runs the CLBlast routine once without measuring its execution time
+template <typename T, typename U>
+void Client<T,U>::RunOnce(const Arguments<U> &args, Buffers<T> &buffers, Queue &queue) {
+  auto status = StatusCode::kSuccess;
+  try {
+    status = run_routine_(args, buffers, queue);
+  } catch (...) { status = static_cast<StatusCode>(kUnknownError); }
+  if (status != StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast error: "+ToString(static_cast<int>(status)));
+  }
+}
+
 // =================================================================================================
 
 // Prints the header of the performance table
@@ -332,6 +411,9 @@ void Client<T,U>::PrintTableHeader(const Arguments<U>& args) {
     if (args.compare_clblas) { fprintf(stdout, " | <--       clBLAS        -->"); }
     if (args.compare_cblas) { fprintf(stdout, " | <--      CPU BLAS       -->"); }
     if (args.compare_cublas) { fprintf(stdout, " | <--       cuBLAS        -->"); }
+    if (reduced_accuracy_) {
+      fprintf(stdout, " | <--        CLBlast reduced accuracy         -->");
+    }
     fprintf(stdout, " |\n");
   }
 
@@ -341,13 +423,17 @@ void Client<T,U>::PrintTableHeader(const Arguments<U>& args) {
   if (args.compare_clblas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_2", "GFLOPS_2", "GBs_2"); }
   if (args.compare_cblas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_3", "GFLOPS_3", "GBs_3"); }
   if (args.compare_cublas) { fprintf(stdout, ";%9s;%9s;%9s", "ms_4", "GFLOPS_4", "GBs_4"); }
+  if (reduced_accuracy_) {
+    fprintf(stdout, ";%9s;%9s;%9s;%9s;%9s", "ms_r", "GFLOPS_r", "GBs_r", "speedup_r", "error_r");
+  }
   fprintf(stdout, "\n");
 }
 
 // Print a performance-result row
 template <typename T, typename U>
 void Client<T,U>::PrintTableRow(const Arguments<U>& args,
-                                const std::vector<std::pair<std::string, double>>& timings) {
+                                const std::vector<std::pair<std::string, double>>& timings,
+                                const double reduced_error) {
 
   // Creates a vector of relevant variables
   auto integers = std::vector<size_t>{};
@@ -415,6 +501,13 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args,
     if (timing.first != "CLBlast") { fprintf(stdout, ";"); }
     fprintf(stdout, "%9.2lf;%9.1lf;%9.1lf", timing.second, gflops, gbs);
   }
+
+  // Outputs the speed-up and the error of the reduced-accuracy mode
+  if (reduced_accuracy_) {
+    const auto ms_reduced = timings.back().second;
+    const auto speedup = (ms_reduced != 0.0) ? timings.front().second / ms_reduced : 0;
+    fprintf(stdout, ";%9.2lf;%9.2le", speedup, reduced_error);
+  }
   fprintf(stdout, "\n");
 }
 
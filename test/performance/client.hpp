@@ -75,12 +75,17 @@ class Client {
   double TimedExecution(const size_t num_runs, const Arguments<U> &args, BufferType &buffers,
                         Queue &queue, RoutineType run_blas, const std::string &library_name);
 
+  // Runs the CLBlast routine once, e.g. to compare its results in different modes
+  void RunOnce(const Arguments<U> &args, Buffers<T> &buffers, Queue &queue);
+
   // Prints the header of a performance-data table
   void PrintTableHeader(const Arguments<U>& args);
 
-  // Prints a row of performance data, including results of two libraries
+  // Prints a row of performance data, including results of two libraries. In reduced-accuracy mode
+  // the last timing is that of CLBlast in reduced-accuracy mode with the given error (see below).
   void PrintTableRow(const Arguments<U>& args,
-                     const std::vector<std::pair<std::string, double>>& timings);
+                     const std::vector<std::pair<std::string, double>>& timings,
+                     const double reduced_error);
 
   // The routine-specific functions passed to the tester
   const Routine run_routine_;
@@ -95,6 +100,7 @@ class Client {
 
   // Extra arguments
   bool warm_up_; // if enabled, do a warm-up run first before measuring execution time
+  bool reduced_accuracy_; // if enabled, also runs CLBlast in reduced-accuracy mode
 };
 
 // =================================================================================================
@@ -0,0 +1,51 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XaxpyBatched routine with its
+// scalars and offsets in device memory. Apart from how the routine is run, the description is the
+// same as that of the regular XaxpyBatched routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYBATCHEDDEVICE_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYBATCHEDDEVICE_H_
+
+#include "test/routines/levelx/xaxpybatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXaxpyBatchedDevice: public TestXaxpyBatched<T> {
+ public:
+
+  // Describes how to run the CLBlast routine: first copies the arguments to the device
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    const auto context = queue.GetContext();
+    const auto alphas = Buffer<T>(context, args.alphas);
+    const auto x_offsets = Buffer<int>(context, std::vector<int>(args.x_offsets.begin(), args.x_offsets.end()));
+    const auto y_offsets = Buffer<int>(context, std::vector<int>(args.y_offsets.begin(), args.y_offsets.end()));
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = AxpyBatched<T>(args.n, alphas(),
+                                 buffers.x_vec(), x_offsets(), args.x_inc,
+                                 buffers.y_vec(), y_offsets(), args.y_inc,
+                                 args.batch_count,
+                                 &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYBATCHEDDEVICE_H_
+#endif
@@ -0,0 +1,55 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XgemmBatched routine with its
+// scalars and offsets in device memory. Apart from how the routine is run, the description is the
+// same as that of the regular XgemmBatched routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMMBATCHEDDEVICE_H_
+#define CLBLAST_TEST_ROUTINES_XGEMMBATCHEDDEVICE_H_
+
+#include "test/routines/levelx/xgemmbatched.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemmBatchedDevice: public TestXgemmBatched<T> {
+ public:
+
+  // Describes how to run the CLBlast routine: first copies the arguments to the device
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    const auto context = queue.GetContext();
+    const auto alphas = Buffer<T>(context, args.alphas);
+    const auto betas = Buffer<T>(context, args.betas);
+    const auto a_offsets = Buffer<int>(context, std::vector<int>(args.a_offsets.begin(), args.a_offsets.end()));
+    const auto b_offsets = Buffer<int>(context, std::vector<int>(args.b_offsets.begin(), args.b_offsets.end()));
+    const auto c_offsets = Buffer<int>(context, std::vector<int>(args.c_offsets.begin(), args.c_offsets.end()));
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = GemmBatched<T>(args.layout, args.a_transpose, args.b_transpose,
+                                 args.m, args.n, args.k, alphas(),
+                                 buffers.a_mat(), a_offsets(), args.a_ld,
+                                 buffers.b_mat(), b_offsets(), args.b_ld, betas(),
+                                 buffers.c_mat(), c_offsets(), args.c_ld,
+                                 args.batch_count,
+                                 &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMMBATCHEDDEVICE_H_
+#endif